@@ -0,0 +1,40 @@
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec4 Color;
+    vec2 TexCoord;
+    flat float TexIndex; // 必须匹配 vertex shader 的 flat
+    float TilingFactor;
+} fs_in;
+
+// 纹理数组模式 (Renderer2D TextureMode::Arrays)
+// 每个槽位绑定一个 sampler2DArray，TexIndex = 槽位 << 11 | 层
+layout(binding = 0) uniform sampler2DArray u_Textures[32];
+
+const int LAYER_BITS = 11; // Renderer2D::ARRAY_LAYER_BITS
+
+void main() {
+    vec4 texColor = fs_in.Color;
+    vec2 tiledCoords = fs_in.TexCoord * abs(fs_in.TilingFactor);
+
+    int index = int(fs_in.TexIndex + 0.5);
+    int slot = index >> LAYER_BITS;
+    float layer = float(index & ((1 << LAYER_BITS) - 1));
+
+    vec4 sampled = texture(u_Textures[slot], vec3(tiledCoords, layer));
+
+    // SDF 字形 (负的 TilingFactor)，与 core_default.frag 相同
+    float edgeWidth = max(fwidth(sampled.a) * 0.7, 1e-4);
+    if (fs_in.TilingFactor < 0.0)
+        sampled = vec4(1.0, 1.0, 1.0, smoothstep(0.5 - edgeWidth, 0.5 + edgeWidth, sampled.a));
+
+    texColor *= sampled;
+
+    // Alpha Cutoff
+    if (texColor.a < 0.01)
+        discard;
+
+    o_Color = texColor;
+}
\ No newline at end of file
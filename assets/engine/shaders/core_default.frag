@@ -15,14 +15,23 @@ layout(binding = 0) uniform sampler2D u_Textures[32];
 
 void main() {
     vec4 texColor = fs_in.Color;
-    vec2 tiledCoords = fs_in.TexCoord * fs_in.TilingFactor;
+    vec2 tiledCoords = fs_in.TexCoord * abs(fs_in.TilingFactor);
 
     // 加上 0.5 避免浮点精度问题导致的索引偏移 (例如 4.999 -> 4)
     int index = int(fs_in.TexIndex + 0.5);
 
     // 动态索引采样
     // 注意：如果 index 超出范围，行为是未定义的，但在我们的 C++ 代码里控制了最大值
-    texColor *= texture(u_Textures[index], tiledCoords);
+    vec4 sampled = texture(u_Textures[index], tiledCoords);
+
+    // 负的 TilingFactor 表示 SDF 字形 (Renderer2D::DrawString)：alpha 是到轮廓的距离，0.5 为边缘。
+    // 按屏幕空间导数取过渡宽度，任意缩放下边缘都只有约一个像素宽
+    // fwidth 必须在分支外计算 (导数要求统一控制流)
+    float edgeWidth = max(fwidth(sampled.a) * 0.7, 1e-4);
+    if (fs_in.TilingFactor < 0.0)
+        sampled = vec4(1.0, 1.0, 1.0, smoothstep(0.5 - edgeWidth, 0.5 + edgeWidth, sampled.a));
+
+    texColor *= sampled;
 
     // Alpha Cutoff
     if (texColor.a < 0.01)
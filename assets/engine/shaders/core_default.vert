@@ -1,10 +1,11 @@
 #version 450 core
 
+// 打包的顶点格式 (24 字节)，见 QuadKernels.h 中的 QuadVertex
 layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec4 a_Color;
-layout(location = 2) in vec2 a_TexCoord;
-layout(location = 3) in float a_TexIndex;
-layout(location = 4) in float a_TilingFactor;
+layout(location = 1) in vec4 a_Color;         // RGBA8 归一化
+layout(location = 2) in vec2 a_TexCoord;      // unorm16 归一化
+layout(location = 3) in float a_TilingFactor; // half float
+layout(location = 4) in uint a_TexIndex;      // 整数属性 (glVertexAttribIPointer)
 
 uniform mat4 u_ViewProjection;
 
@@ -19,7 +20,7 @@ out VS_OUT {
 void main() {
     vs_out.Color = a_Color;
     vs_out.TexCoord = a_TexCoord;
-    vs_out.TexIndex = a_TexIndex;
+    vs_out.TexIndex = float(a_TexIndex);
     vs_out.TilingFactor = a_TilingFactor;
     
     gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
@@ -0,0 +1,13 @@
+#version 450 core
+
+// 全屏三角形，没有顶点缓冲：gl_VertexID 0, 1, 2 生成 (-1,-1), (3,-1), (-1,3)，裁剪后正好盖住视口
+out VS_OUT {
+    vec2 TexCoord;
+} vs_out;
+
+void main() {
+    vec2 uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    vs_out.TexCoord = uv;
+
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
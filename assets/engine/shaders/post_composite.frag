@@ -0,0 +1,49 @@
+#version 450 core
+
+// 合成：场景 + bloom (第 0 级再做一次 tent 升采样)，乘曝光后做色调映射，写入窗口
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec2 TexCoord;
+} fs_in;
+
+uniform sampler2D u_Scene;
+uniform sampler2D u_Bloom;
+uniform float u_BloomIntensity; // 0: 没有 bloom，u_Bloom 不读
+uniform float u_BloomRadius;
+uniform float u_Exposure;
+uniform int u_ToneMapper;       // 见 PostProcess.h 中的 ToneMapper: 0 None, 1 Reinhard, 2 ACES
+
+vec3 Tent(sampler2D source, vec2 uv, float radius) {
+    vec2 d = radius / vec2(textureSize(source, 0));
+    vec3 color = texture(source, uv).rgb * 4.0;
+    color += (texture(source, uv + vec2(-d.x, 0.0)).rgb + texture(source, uv + vec2(d.x, 0.0)).rgb +
+              texture(source, uv + vec2(0.0, -d.y)).rgb + texture(source, uv + vec2(0.0, d.y)).rgb) * 2.0;
+    color += texture(source, uv + vec2(-d.x, -d.y)).rgb + texture(source, uv + vec2(d.x, -d.y)).rgb +
+             texture(source, uv + vec2(-d.x, d.y)).rgb + texture(source, uv + vec2(d.x, d.y)).rgb;
+    return color * (1.0 / 16.0);
+}
+
+// Narkowicz 2015, "ACES Filmic Tone Mapping Curve"
+vec3 ACES(vec3 x) {
+    return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);
+}
+
+void main() {
+    vec2 uv = fs_in.TexCoord;
+    vec3 color = texture(u_Scene, uv).rgb;
+    if (u_BloomIntensity > 0.0) {
+        color += Tent(u_Bloom, uv, u_BloomRadius) * u_BloomIntensity;
+    }
+    color *= u_Exposure;
+
+    if (u_ToneMapper == 1) {
+        color = color / (1.0 + color);
+    } else if (u_ToneMapper == 2) {
+        color = ACES(color);
+    } else {
+        color = clamp(color, 0.0, 1.0);
+    }
+
+    o_Color = vec4(color, 1.0);
+}
@@ -0,0 +1,77 @@
+#version 450 core
+
+// Bloom 降采样：13 次采样的滤波 (Jimenez, "Next Generation Post Processing in Call of Duty:
+// Advanced Warfare")。目标尺寸是源的一半，偏移以源纹素为单位；双线性采样让 13 次采样覆盖
+// 36 个纹素，避免简单 2x2 平均在移动时的闪烁。
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec2 TexCoord;
+} fs_in;
+
+uniform sampler2D u_Source;
+uniform int u_Prefilter;  // 1: 第一级，从场景取样，先做阈值再做 Karis 平均
+uniform vec4 u_Threshold; // x: 阈值, y: 阈值 - knee, z: 2 * knee, w: 0.25 / knee
+
+// 软阈值：低于 阈值 - knee 的部分去掉，knee 区间内二次过渡
+vec3 Threshold(vec3 color) {
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - u_Threshold.y, 0.0, u_Threshold.z);
+    soft = soft * soft * u_Threshold.w;
+    float contribution = max(soft, brightness - u_Threshold.x) / max(brightness, 1e-4);
+    return color * contribution;
+}
+
+// 按亮度降权，单个极亮像素 (萤火虫) 不会炸成一大片光斑
+float KarisWeight(vec3 color) {
+    return 1.0 / (1.0 + dot(color, vec3(0.2126, 0.7152, 0.0722)));
+}
+
+vec3 Sample(vec2 uv, vec2 texel, vec2 offset) {
+    return texture(u_Source, uv + texel * offset).rgb;
+}
+
+void main() {
+    vec2 texel = 1.0 / vec2(textureSize(u_Source, 0));
+    vec2 uv = fs_in.TexCoord;
+
+    vec3 a = Sample(uv, texel, vec2(-2.0,  2.0));
+    vec3 b = Sample(uv, texel, vec2( 0.0,  2.0));
+    vec3 c = Sample(uv, texel, vec2( 2.0,  2.0));
+    vec3 d = Sample(uv, texel, vec2(-2.0,  0.0));
+    vec3 e = Sample(uv, texel, vec2( 0.0,  0.0));
+    vec3 f = Sample(uv, texel, vec2( 2.0,  0.0));
+    vec3 g = Sample(uv, texel, vec2(-2.0, -2.0));
+    vec3 h = Sample(uv, texel, vec2( 0.0, -2.0));
+    vec3 i = Sample(uv, texel, vec2( 2.0, -2.0));
+    vec3 j = Sample(uv, texel, vec2(-1.0,  1.0));
+    vec3 k = Sample(uv, texel, vec2( 1.0,  1.0));
+    vec3 l = Sample(uv, texel, vec2(-1.0, -1.0));
+    vec3 m = Sample(uv, texel, vec2( 1.0, -1.0));
+
+    // 五个重叠的 2x2 盒子：中间一个权重 0.5，四角各 0.125
+    vec3 boxes[5] = vec3[5](
+        (j + k + l + m) * 0.25,
+        (a + b + d + e) * 0.25,
+        (b + c + e + f) * 0.25,
+        (d + e + g + h) * 0.25,
+        (e + f + h + i) * 0.25
+    );
+    const float weights[5] = float[5](0.5, 0.125, 0.125, 0.125, 0.125);
+
+    vec3 color = vec3(0.0);
+    if (u_Prefilter == 1) {
+        float total = 0.0;
+        for (int n = 0; n < 5; n++) {
+            vec3 box = Threshold(boxes[n]);
+            float weight = weights[n] * KarisWeight(box);
+            color += box * weight;
+            total += weight;
+        }
+        color /= max(total, 1e-4);
+    } else {
+        for (int n = 0; n < 5; n++) color += boxes[n] * weights[n];
+    }
+
+    o_Color = vec4(color, 1.0);
+}
@@ -0,0 +1,25 @@
+#version 450 core
+
+// Bloom 升采样：3x3 tent 滤波读取较小的一级，混合模式为相加，直接叠到较大一级上
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec2 TexCoord;
+} fs_in;
+
+uniform sampler2D u_Source;
+uniform float u_Radius; // 以源纹素为单位
+
+void main() {
+    vec2 d = u_Radius / vec2(textureSize(u_Source, 0));
+    vec2 uv = fs_in.TexCoord;
+
+    // 1 2 1 / 2 4 2 / 1 2 1，总和 16
+    vec3 color = texture(u_Source, uv).rgb * 4.0;
+    color += (texture(u_Source, uv + vec2(-d.x, 0.0)).rgb + texture(u_Source, uv + vec2(d.x, 0.0)).rgb +
+              texture(u_Source, uv + vec2(0.0, -d.y)).rgb + texture(u_Source, uv + vec2(0.0, d.y)).rgb) * 2.0;
+    color += texture(u_Source, uv + vec2(-d.x, -d.y)).rgb + texture(u_Source, uv + vec2(d.x, -d.y)).rgb +
+             texture(u_Source, uv + vec2(-d.x, d.y)).rgb + texture(u_Source, uv + vec2(d.x, d.y)).rgb;
+
+    o_Color = vec4(color * (1.0 / 16.0), 1.0);
+}
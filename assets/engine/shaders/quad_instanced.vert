@@ -0,0 +1,45 @@
+#version 450 core
+
+// Per-instance attributes (divisor 1), one record per quad
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Size;
+layout(location = 2) in float a_Rotation;
+layout(location = 3) in vec4 a_Color;         // RGBA8 归一化
+layout(location = 4) in vec4 a_TexRect;       // unorm16 归一化 (min.uv, max.uv)
+layout(location = 5) in float a_TilingFactor; // half float
+layout(location = 6) in uint a_TexIndex;      // 整数属性
+
+uniform mat4 u_ViewProjection;
+
+// 必须与 core_default.vert 的输出保持一致，两条管线共用 core_default.frag
+out VS_OUT {
+    vec4 Color;
+    vec2 TexCoord;
+    flat float TexIndex;
+    float TilingFactor;
+} vs_out;
+
+// 每个实例 6 个顶点 (两个三角形)，顺序与批处理的索引缓冲相同: 0-1-2, 2-3-0
+const vec2 c_Corners[4] = vec2[](
+    vec2(-0.5, -0.5),
+    vec2( 0.5, -0.5),
+    vec2( 0.5,  0.5),
+    vec2(-0.5,  0.5)
+);
+const int c_Indices[6] = int[](0, 1, 2, 2, 3, 0);
+
+void main() {
+    vec2 corner = c_Corners[c_Indices[gl_VertexID]];
+
+    vec2 local = corner * a_Size;
+    float c = cos(a_Rotation);
+    float s = sin(a_Rotation);
+    vec2 world = a_Position.xy + vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+
+    vs_out.Color = a_Color;
+    vs_out.TexCoord = mix(a_TexRect.xy, a_TexRect.zw, corner + 0.5);
+    vs_out.TexIndex = float(a_TexIndex);
+    vs_out.TilingFactor = a_TilingFactor;
+
+    gl_Position = u_ViewProjection * vec4(world, a_Position.z, 1.0);
+}
@@ -0,0 +1,25 @@
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec4 Color;
+    vec2 Local;
+    flat float Thickness;
+} fs_in;
+
+void main() {
+    // 到圆心的距离，1 为外边缘；过渡宽度按屏幕空间导数取，任意缩放下都约一个像素
+    float dist = length(fs_in.Local);
+    float edgeWidth = max(fwidth(dist), 1e-4);
+
+    float alpha = 1.0 - smoothstep(1.0 - edgeWidth, 1.0, dist);
+    // 圆环：内边缘同样抗锯齿；实心时 Thickness 为 1，这一项恒为 1
+    alpha *= smoothstep(1.0 - fs_in.Thickness - edgeWidth, 1.0 - fs_in.Thickness, dist);
+
+    // 四个角和环内的像素丢弃，避免写入深度挡住后面的内容
+    if (alpha * fs_in.Color.a < 0.01)
+        discard;
+
+    o_Color = vec4(fs_in.Color.rgb, fs_in.Color.a * alpha);
+}
@@ -0,0 +1,23 @@
+#version 450 core
+
+// 圆形 / 圆环，见 Renderer2D.cpp 中的 CircleVertex (28 字节)
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Local;     // 圆内局部坐标 [-1, 1]
+layout(location = 2) in vec4 a_Color;     // RGBA8 归一化
+layout(location = 3) in float a_Thickness; // 环宽占半径的比例，1 为实心
+
+uniform mat4 u_ViewProjection;
+
+out VS_OUT {
+    vec4 Color;
+    vec2 Local;
+    flat float Thickness;
+} vs_out;
+
+void main() {
+    vs_out.Color = a_Color;
+    vs_out.Local = a_Local;
+    vs_out.Thickness = a_Thickness;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
@@ -0,0 +1,20 @@
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec4 Color;
+    float Across;
+} fs_in;
+
+void main() {
+    // 只对两条长边做抗锯齿，端点是方头
+    float dist = abs(fs_in.Across);
+    float edgeWidth = max(fwidth(dist), 1e-4);
+    float alpha = 1.0 - smoothstep(1.0 - edgeWidth, 1.0, dist);
+
+    if (alpha * fs_in.Color.a < 0.01)
+        discard;
+
+    o_Color = vec4(fs_in.Color.rgb, fs_in.Color.a * alpha);
+}
@@ -0,0 +1,20 @@
+#version 450 core
+
+// 带宽度的线段，见 Renderer2D.cpp 中的 LineVertex (20 字节)
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;  // RGBA8 归一化
+layout(location = 2) in float a_Across; // 横跨线宽的坐标，两侧边缘分别为 -1 和 1
+
+uniform mat4 u_ViewProjection;
+
+out VS_OUT {
+    vec4 Color;
+    float Across;
+} vs_out;
+
+void main() {
+    vs_out.Color = a_Color;
+    vs_out.Across = a_Across;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
@@ -0,0 +1,30 @@
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in VS_OUT {
+    vec4 Color;
+    vec2 Local;
+    flat vec4 Shape;
+} fs_in;
+
+void main() {
+    vec2 halfSize = fs_in.Shape.xy;
+    float radius = fs_in.Shape.z;
+    float thickness = fs_in.Shape.w;
+
+    // 圆角矩形的有向距离：内部为负，边缘为 0，单位与 Local 相同 (世界单位)
+    vec2 q = abs(fs_in.Local) - halfSize + radius;
+    float dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;
+    float edgeWidth = max(fwidth(dist), 1e-6);
+
+    float alpha = 1.0 - smoothstep(-edgeWidth, 0.0, dist);
+    // 描边：只保留距离边缘 thickness 以内的部分
+    if (thickness > 0.0)
+        alpha *= smoothstep(-thickness - edgeWidth, -thickness, dist);
+
+    if (alpha * fs_in.Color.a < 0.01)
+        discard;
+
+    o_Color = vec4(fs_in.Color.rgb, fs_in.Color.a * alpha);
+}
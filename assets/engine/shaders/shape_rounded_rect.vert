@@ -0,0 +1,23 @@
+#version 450 core
+
+// 圆角矩形，见 Renderer2D.cpp 中的 RoundedRectVertex (40 字节)
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Local; // 相对中心的局部坐标，世界单位
+layout(location = 2) in vec4 a_Color; // RGBA8 归一化
+layout(location = 3) in vec4 a_Shape; // 半尺寸 xy，圆角半径，描边宽度 (0 为实心)
+
+uniform mat4 u_ViewProjection;
+
+out VS_OUT {
+    vec4 Color;
+    vec2 Local;
+    flat vec4 Shape;
+} vs_out;
+
+void main() {
+    vs_out.Color = a_Color;
+    vs_out.Local = a_Local;
+    vs_out.Shape = a_Shape;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
@@ -0,0 +1,199 @@
+#include "Bench.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace Bench {
+
+struct Entry {
+    const char* Name;
+    BenchmarkFn Fn;
+};
+
+struct Result {
+    std::string Name;
+    uint64_t Iterations = 0;
+    double NsPerOp = 0.0;
+    double ItemsPerSecond = 0.0;
+    std::vector<std::pair<std::string, double>> Counters;
+    std::string SkipReason;
+};
+
+// Function-local so registration from other translation units does not depend on init order
+static std::vector<Entry>& GetRegistry() {
+    static std::vector<Entry> registry;
+    return registry;
+}
+
+void Register(const char* name, BenchmarkFn fn) {
+    GetRegistry().push_back({name, fn});
+}
+
+void State::SetCounter(const std::string& name, double value) {
+    for (auto& counter : m_Counters) {
+        if (counter.first == name) {
+            counter.second = value;
+            return;
+        }
+    }
+    m_Counters.emplace_back(name, value);
+}
+
+static Result Run(const Entry& entry, double minTime) {
+    constexpr uint64_t MAX_ITERATIONS = 1000000000;
+
+    uint64_t iterations = 1;
+    while (true) {
+        State state(iterations);
+        entry.Fn(state);
+
+        if (!state.GetSkipReason().empty()) {
+            Result result;
+            result.Name = entry.Name;
+            result.SkipReason = state.GetSkipReason();
+            return result;
+        }
+
+        const double elapsed = state.GetElapsedSeconds();
+        if (elapsed >= minTime || iterations >= MAX_ITERATIONS) {
+            Result result;
+            result.Name = entry.Name;
+            result.Iterations = iterations;
+            result.NsPerOp = elapsed * 1e9 / static_cast<double>(iterations);
+            result.ItemsPerSecond = elapsed > 0.0 ? static_cast<double>(state.GetItemsProcessed()) / elapsed : 0.0;
+            result.Counters = state.GetCounters();
+            return result;
+        }
+
+        // Aim a bit past minTime so the next run is usually the last, but grow at most 100x
+        // at a time in case the first runs were dominated by warm-up
+        double scale = elapsed > 0.0 ? minTime * 1.4 / elapsed : 100.0;
+        scale = std::min(std::max(scale, 2.0), 100.0);
+        iterations = std::min(static_cast<uint64_t>(static_cast<double>(iterations) * scale), MAX_ITERATIONS);
+    }
+}
+
+static std::string EscapeJSON(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static void WriteJSON(std::ostream& out, const std::vector<Result>& results, double minTime) {
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"date\": \"" << date << "\",\n";
+    out << "    \"simd\": \"" << Engine::QuadKernels::GetISA() << "\",\n";
+#ifdef NDEBUG
+    out << "    \"build\": \"release\",\n";
+#else
+    out << "    \"build\": \"debug\",\n";
+#endif
+    out << "    \"min_time\": " << minTime << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        out << (i ? ",\n" : "\n") << "    {";
+        out << "\"name\": \"" << EscapeJSON(result.Name) << "\", ";
+        out << "\"iterations\": " << result.Iterations << ", ";
+        out << "\"ns_per_op\": " << result.NsPerOp << ", ";
+        out << "\"items_per_second\": " << result.ItemsPerSecond;
+        for (const auto& [name, value] : result.Counters) {
+            out << ", \"" << EscapeJSON(name) << "\": " << value;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static int Main(int argc, char** argv) {
+    std::string filter;
+    std::string outPath;
+    double minTime = 0.5;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(arg, "--min-time") == 0 && i + 1 < argc) {
+            minTime = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (std::strcmp(arg, "--list") == 0) {
+            list = true;
+        } else {
+            std::cerr << "Usage: Shader2DBench [--filter <substring>] [--min-time <seconds>] [--out <file.json>] [--list]\n";
+            return 1;
+        }
+    }
+
+    std::vector<Entry> entries = GetRegistry();
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return std::strcmp(a.Name, b.Name) < 0; });
+
+    if (list) {
+        for (const Entry& entry : entries) std::cout << entry.Name << "\n";
+        return 0;
+    }
+
+    // Headless: every renderer object records into memory instead of talking to a GPU.
+    // Geometry copies would measure the recorder, not the renderer, so they stay off.
+    Engine::Log::Init();
+    Engine::Log::GetCoreLogger()->set_level(spdlog::level::warn);
+    Engine::RendererAPI::SetAPI(Engine::RendererAPI::API::Capture);
+    Engine::CaptureRecorder::SetRecordGeometry(false);
+
+    std::vector<Result> results;
+    for (const Entry& entry : entries) {
+        if (!filter.empty() && std::string(entry.Name).find(filter) == std::string::npos) continue;
+
+        Result result = Run(entry, minTime);
+        if (!result.SkipReason.empty()) {
+            std::cerr << entry.Name << ": skipped, " << result.SkipReason << "\n";
+            continue;
+        }
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-48s %14.1f ns/op %14.4g items/s\n", result.Name.c_str(), result.NsPerOp,
+                      result.ItemsPerSecond);
+        std::cerr << line;
+        results.push_back(std::move(result));
+    }
+
+    if (outPath.empty()) {
+        WriteJSON(std::cout, results, minTime);
+        return 0;
+    }
+    std::ofstream out(outPath);
+    if (!out) {
+        std::cerr << "Shader2DBench: could not write " << outPath << "\n";
+        return 1;
+    }
+    WriteJSON(out, results, minTime);
+    return 0;
+}
+
+}
+
+int main(int argc, char** argv) {
+    return Bench::Main(argc, argv);
+}
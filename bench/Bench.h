@@ -0,0 +1,111 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal in-tree microbenchmark harness for Shader2DBench.
+//
+//   BENCHMARK("Group/Case") {
+//       ...setup...
+//       while (state.KeepRunning()) { ...one op... }
+//       state.SetItemsProcessed(state.GetIterations() * itemsPerOp);
+//   }
+//
+// A benchmark that cannot run calls state.SkipWithError(reason) and returns; it is reported
+// but left out of the JSON.
+//
+// The timer runs from the first KeepRunning() to the last one, so setup and teardown around the
+// loop are not measured. The runner grows the iteration count until a run lasts --min-time.
+namespace Bench {
+
+class State {
+public:
+    explicit State(uint64_t iterations) : m_Iterations(iterations), m_Remaining(iterations) {}
+
+    bool KeepRunning() {
+        if (m_Remaining == 0) {
+            if (m_Running) StopTimer();
+            return false;
+        }
+        if (m_Remaining == m_Iterations) StartTimer();
+        m_Remaining--;
+        return true;
+    }
+
+    // Excludes per-iteration housekeeping from the measurement
+    void PauseTiming() { StopTimer(); }
+    void ResumeTiming() { StartTimer(); }
+
+    uint64_t GetIterations() const { return m_Iterations; }
+    double GetElapsedSeconds() const { return m_Elapsed; }
+
+    void SetItemsProcessed(uint64_t items) { m_Items = items; }
+    uint64_t GetItemsProcessed() const { return m_Items; }
+
+    // Marks the run as skipped, e.g. when an input file is missing; return right after
+    void SkipWithError(const std::string& reason) { m_SkipReason = reason; }
+    const std::string& GetSkipReason() const { return m_SkipReason; }
+
+    // Extra values reported next to the timings, e.g. draw calls per op
+    void SetCounter(const std::string& name, double value);
+    const std::vector<std::pair<std::string, double>>& GetCounters() const { return m_Counters; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void StartTimer() {
+        m_Running = true;
+        m_Start = Clock::now();
+    }
+    void StopTimer() {
+        m_Elapsed += std::chrono::duration<double>(Clock::now() - m_Start).count();
+        m_Running = false;
+    }
+
+    uint64_t m_Iterations;
+    uint64_t m_Remaining;
+    uint64_t m_Items = 0;
+    bool m_Running = false;
+    double m_Elapsed = 0.0;
+    Clock::time_point m_Start;
+    std::vector<std::pair<std::string, double>> m_Counters;
+    std::string m_SkipReason;
+};
+
+using BenchmarkFn = void (*)(State&);
+
+void Register(const char* name, BenchmarkFn fn);
+
+struct Registrar {
+    Registrar(const char* name, BenchmarkFn fn) { Register(name, fn); }
+};
+
+// Keeps the compiler from discarding a result that is otherwise unused
+template <typename T> inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Forces pending stores to memory, for loops whose only effect is writing a buffer
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+}
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+#define BENCHMARK(name)                                                                                                \
+    static void BENCH_CONCAT(BenchFn_, __LINE__)(::Bench::State & state);                                              \
+    static ::Bench::Registrar BENCH_CONCAT(BenchReg_, __LINE__)(name, &BENCH_CONCAT(BenchFn_, __LINE__));            \
+    static void BENCH_CONCAT(BenchFn_, __LINE__)(::Bench::State & state)
@@ -0,0 +1,131 @@
+#include "Bench.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Events/ApplicationEvent.h"
+#include "Engine/Events/Event.h"
+#include "Engine/Renderer/Buffer.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Engine/Renderer/RendererStats.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Renderer/Texture.h"
+
+using namespace Engine;
+
+BENCHMARK("BufferLayout/Construct") {
+    while (state.KeepRunning()) {
+        BufferLayout layout = {
+            {ShaderDataType::Float3, "a_Position"},
+            {ShaderDataType::UByte4, "a_Color", true},
+            {ShaderDataType::UShort2, "a_TexCoord", true},
+            {ShaderDataType::Half, "a_TilingFactor"},
+            {ShaderDataType::UShort, "a_TexIndex"},
+        };
+        Bench::DoNotOptimize(layout.GetStride());
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+BENCHMARK("OrthographicCamera/SetPosition") {
+    OrthographicCamera camera(16.0f / 9.0f);
+    float x = 0.0f;
+    while (state.KeepRunning()) {
+        x += 0.001f;
+        camera.SetPosition({x, -x, 0.0f});
+        Bench::DoNotOptimize(camera.GetViewProjectionMatrix());
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+BENCHMARK("OrthographicCamera/SetRotation") {
+    OrthographicCamera camera(16.0f / 9.0f);
+    float angle = 0.0f;
+    while (state.KeepRunning()) {
+        angle += 0.001f;
+        camera.SetRotation(angle);
+        Bench::DoNotOptimize(camera.GetViewProjectionMatrix());
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+BENCHMARK("SubTexture2D/CreateFromCoords") {
+    auto sheet = Texture2D::Create(1024, 1024);
+    uint32_t cell = 0;
+    while (state.KeepRunning()) {
+        auto region = SubTexture2D::CreateFromCoords(sheet, {float(cell % 32), float(cell / 32 % 32)}, {32.0f, 32.0f});
+        Bench::DoNotOptimize(region->GetTexCoords()[0]);
+        cell++;
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+// Layer::OnEvent shape: a dispatcher tried against a few handlers, one of them matching
+BENCHMARK("Events/Dispatch") {
+    WindowResizeEvent event(1280, 720);
+    Event& base = event;
+    uint64_t handled = 0;
+    while (state.KeepRunning()) {
+        base.Handled = false;
+        EventDispatcher dispatcher(base);
+        dispatcher.Dispatch<WindowCloseEvent>([&](WindowCloseEvent&) { return true; });
+        dispatcher.Dispatch<AppTickEvent>([&](AppTickEvent&) { return true; });
+        dispatcher.Dispatch<WindowResizeEvent>([&](WindowResizeEvent& e) {
+            handled += e.GetWidth();
+            return false;
+        });
+        Bench::DoNotOptimize(handled);
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+// Runs once per frame in ResetStats
+BENCHMARK("RendererStatsHistory/Push") {
+    RendererStatsHistory history;
+    RendererStats stats;
+    while (state.KeepRunning()) {
+        stats.DrawCalls++;
+        history.Push(stats);
+    }
+    Bench::DoNotOptimize(history.GetFrameCount());
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+BENCHMARK("RendererStatsHistory/ToString") {
+    RendererStatsHistory history;
+    RendererStats stats;
+    for (uint32_t i = 0; i < history.GetCapacity(); i++) {
+        stats.DrawCalls = i * 7919 % 97;
+        history.Push(stats);
+    }
+    while (state.KeepRunning()) {
+        std::string text = history.ToString();
+        Bench::DoNotOptimize(text.size());
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+// ProfileScope directly, so the cost is measured whether or not ENG_PROFILING is on. Target: < 50 ns
+BENCHMARK("Profiler/ScopeInactive") {
+    while (state.KeepRunning()) {
+        ProfileScope scope("Bench");
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+BENCHMARK("Profiler/ScopeRecorded") {
+    const uint64_t SESSION_EVENTS = 1 << 20;
+    Profiler::BeginSession();
+    uint64_t recorded = 0;
+    while (state.KeepRunning()) {
+        ProfileScope scope("Bench");
+        if (++recorded == SESSION_EVENTS) {
+            // Bound the event memory; a new session reuses the chunks
+            state.PauseTiming();
+            Profiler::CancelSession();
+            Profiler::BeginSession();
+            recorded = 0;
+            state.ResumeTiming();
+        }
+    }
+    Profiler::CancelSession();
+    state.SetItemsProcessed(state.GetIterations());
+}
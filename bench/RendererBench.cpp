@@ -0,0 +1,680 @@
+#include "Bench.h"
+
+#include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/OrthographicCamera.h"
+#include "Engine/Renderer/ParticleSystem.h"
+#include "Engine/Renderer/PostProcess.h"
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/RenderTargetPool.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/SpriteAnimation.h"
+#include "Engine/Renderer/SpriteGrid.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Renderer/TextLayout.h"
+#include "Engine/Renderer/Tilemap.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+
+constexpr size_t SCENE_QUADS = 10000;
+
+// Deterministic sprite soup. On screen means inside the default 16:9 camera view.
+struct Sprites {
+    std::vector<Vec3> Positions;
+    std::vector<Vec2> Sizes;
+    std::vector<float> Rotations;
+    std::vector<Vec4> Colors;
+
+    Sprites(size_t count, bool onScreen) {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> x(-1.7f, 1.7f), y(-0.95f, 0.95f), size(0.01f, 0.05f),
+            angle(-3.14f, 3.14f), unit(0.0f, 1.0f);
+        const float offset = onScreen ? 0.0f : 100.0f;
+        for (size_t i = 0; i < count; i++) {
+            Positions.push_back({x(rng) + offset, y(rng), 0.0f});
+            float s = size(rng);
+            Sizes.push_back({s, s});
+            Rotations.push_back(angle(rng));
+            Colors.push_back({unit(rng), unit(rng), unit(rng), 1.0f});
+        }
+    }
+
+    QuadSpan Span(bool rotated) const {
+        QuadSpan span;
+        span.Count = Positions.size();
+        span.Positions = Positions.data();
+        span.Sizes = Sizes.data();
+        span.Rotations = rotated ? Rotations.data() : nullptr;
+        span.Colors = Colors.data();
+        return span;
+    }
+};
+
+// Renderer2D on the Capture backend for the lifetime of one benchmark run. End() drops the
+// recorded commands so memory stays flat however many scenes are drawn.
+class RendererScene {
+public:
+    explicit RendererScene(TextureMode mode = TextureMode::Auto, QuadPipeline pipeline = QuadPipeline::Batched,
+                           SubmissionMode submission = SubmissionMode::Immediate)
+        : m_Camera(16.0f / 9.0f) {
+        Renderer2D::Init(mode);
+        Renderer2D::SetQuadPipeline(pipeline);
+        Renderer2D::SetSubmissionMode(submission);
+        m_Shader = Shader::Create("assets/engine/shaders/core_default.vert",
+                                  Renderer2D::GetTextureMode() == TextureMode::Arrays
+                                      ? "assets/engine/shaders/core_array.frag"
+                                      : "assets/engine/shaders/core_default.frag");
+    }
+
+    ~RendererScene() {
+        Renderer2D::SetQuadPipeline(QuadPipeline::Batched);
+        Renderer2D::SetSubmissionMode(SubmissionMode::Immediate);
+        Renderer2D::Shutdown();
+        CaptureRecorder::Clear();
+    }
+
+    void Begin() {
+        Renderer2D::ResetStats();
+        Renderer2D::BeginScene(m_Camera, *m_Shader);
+    }
+
+    void End() {
+        Renderer2D::EndScene();
+        CaptureRecorder::Clear();
+    }
+
+    // Runs `draw` inside a scene once untimed, so buffers and lookup tables are warm, then once
+    // per iteration. Reports quads per second and the batching of the last scene.
+    template <typename F> void Measure(Bench::State& state, size_t quadsPerScene, F&& draw) {
+        Begin();
+        draw();
+        End();
+
+        while (state.KeepRunning()) {
+            Begin();
+            draw();
+            End();
+        }
+
+        const RendererStats& stats = Renderer2D::GetStats();
+        state.SetItemsProcessed(state.GetIterations() * quadsPerScene);
+        state.SetCounter("draw_calls", stats.DrawCalls);
+        state.SetCounter("culled", stats.CulledCount);
+        state.SetCounter("bytes_uploaded", static_cast<double>(stats.BytesUploaded));
+        state.SetCounter("unique_textures", stats.UniqueTextures);
+    }
+
+private:
+    OrthographicCamera m_Camera;
+    std::shared_ptr<Shader> m_Shader;
+};
+
+std::vector<std::shared_ptr<Texture2D>> MakeTextures(size_t count, uint32_t size = 32) {
+    std::vector<std::shared_ptr<Texture2D>> textures;
+    for (size_t i = 0; i < count; i++) textures.push_back(Texture2D::Create(size, size));
+    return textures;
+}
+
+} // namespace
+
+// --- Per-call submission ---
+
+BENCHMARK("Renderer2D/DrawQuad/Colored") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene;
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], sprites.Colors[i]);
+        }
+    });
+}
+
+BENCHMARK("Renderer2D/DrawQuad/Textured") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene;
+    auto texture = Texture2D::Create(32, 32);
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], texture);
+        }
+    });
+}
+
+BENCHMARK("Renderer2D/DrawRotatedQuad/Colored") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene;
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawRotatedQuad(sprites.Positions[i], sprites.Sizes[i], sprites.Rotations[i], sprites.Colors[i]);
+        }
+    });
+}
+
+BENCHMARK("Renderer2D/DrawQuad/Culled") {
+    Sprites sprites(SCENE_QUADS, false);
+    RendererScene scene;
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], sprites.Colors[i]);
+        }
+    });
+}
+
+// --- Textures: 32 distinct textures interleaved, per texture mode and submission mode ---
+
+static void DrawInterleaved(Bench::State& state, TextureMode mode, SubmissionMode submission, size_t textureCount) {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene(mode, QuadPipeline::Batched, submission);
+    auto textures = MakeTextures(textureCount);
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], textures[i % textures.size()]);
+        }
+    });
+}
+
+BENCHMARK("Renderer2D/Textures32/Slots") {
+    DrawInterleaved(state, TextureMode::Slots, SubmissionMode::Immediate, 32);
+}
+
+BENCHMARK("Renderer2D/Textures32/Slots/Deferred") {
+    DrawInterleaved(state, TextureMode::Slots, SubmissionMode::Deferred, 32);
+}
+
+BENCHMARK("Renderer2D/Textures32/Arrays") {
+    DrawInterleaved(state, TextureMode::Arrays, SubmissionMode::Immediate, 32);
+}
+
+// --- 500 sprites: one atlas page vs one texture each ---
+
+BENCHMARK("Renderer2D/Sprites500/Atlas") {
+    constexpr size_t COUNT = 500;
+    Sprites sprites(COUNT, true);
+    RendererScene scene(TextureMode::Slots);
+    auto page = Texture2D::Create(1024, 1024);
+    std::vector<std::shared_ptr<SubTexture2D>> regions;
+    for (size_t i = 0; i < COUNT; i++) {
+        regions.push_back(SubTexture2D::CreateFromCoords(page, {float(i % 32), float(i / 32)}, {32.0f, 32.0f}));
+    }
+    scene.Measure(state, COUNT, [&]() {
+        for (size_t i = 0; i < COUNT; i++) Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], regions[i]);
+    });
+}
+
+BENCHMARK("Renderer2D/Sprites500/Separate") {
+    constexpr size_t COUNT = 500;
+    Sprites sprites(COUNT, true);
+    RendererScene scene(TextureMode::Slots);
+    auto textures = MakeTextures(COUNT);
+    scene.Measure(state, COUNT, [&]() {
+        for (size_t i = 0; i < COUNT; i++) Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], textures[i]);
+    });
+}
+
+// --- Bulk submission and pipelines ---
+
+BENCHMARK("Renderer2D/DrawQuads/Colored") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene;
+    QuadSpan span = sprites.Span(false);
+    scene.Measure(state, SCENE_QUADS, [&]() { Renderer2D::DrawQuads(span); });
+}
+
+BENCHMARK("Renderer2D/DrawQuads/Rotated") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene;
+    QuadSpan span = sprites.Span(true);
+    scene.Measure(state, SCENE_QUADS, [&]() { Renderer2D::DrawQuads(span); });
+}
+
+BENCHMARK("Renderer2D/DrawQuads/Instanced") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene(TextureMode::Auto, QuadPipeline::Instanced);
+    QuadSpan span = sprites.Span(true);
+    scene.Measure(state, SCENE_QUADS, [&]() { Renderer2D::DrawQuads(span); });
+}
+
+BENCHMARK("Renderer2D/DrawQuad/Deferred") {
+    Sprites sprites(SCENE_QUADS, true);
+    RendererScene scene(TextureMode::Auto, QuadPipeline::Batched, SubmissionMode::Deferred);
+    scene.Measure(state, SCENE_QUADS, [&]() {
+        for (size_t i = 0; i < SCENE_QUADS; i++) {
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], sprites.Colors[i]);
+        }
+    });
+}
+
+// --- Spatial index: the map grows, the view and the sprite density stay ---
+// ~2000 sprites are on screen at every map size; with the grid the time per scene should not
+// follow the map size, the flat DrawQuads comparison does.
+
+constexpr float MAP_DENSITY = 300.0f; // sprites per square unit
+
+static Sprites MakeMap(size_t count) {
+    Sprites map(count, true);
+    std::mt19937 rng(99);
+    const float half = 0.5f * std::sqrt(count / MAP_DENSITY);
+    std::uniform_real_distribution<float> coord(-half, half);
+    for (Vec3& position : map.Positions) position = {coord(rng), coord(rng), 0.0f};
+    return map;
+}
+
+static void DrawMapGrid(Bench::State& state, size_t count) {
+    Sprites map = MakeMap(count);
+    SpriteGrid grid(0.25f);
+    for (size_t i = 0; i < count; i++) {
+        grid.Insert(map.Positions[i], map.Sizes[i], map.Rotations[i], map.Colors[i]);
+    }
+    RendererScene scene;
+    scene.Measure(state, 1, [&]() { Renderer2D::DrawSpriteGrid(grid); });
+    state.SetCounter("map_sprites", static_cast<double>(count));
+    state.SetCounter("drawn", Renderer2D::GetStats().QuadCount);
+}
+
+BENCHMARK("SpriteGrid/Draw/Map10K") { DrawMapGrid(state, 10000); }
+BENCHMARK("SpriteGrid/Draw/Map100K") { DrawMapGrid(state, 100000); }
+BENCHMARK("SpriteGrid/Draw/Map1M") { DrawMapGrid(state, 1000000); }
+
+BENCHMARK("SpriteGrid/DrawQuads/Map1M") {
+    Sprites map = MakeMap(1000000);
+    RendererScene scene;
+    QuadSpan span = map.Span(true);
+    scene.Measure(state, 1, [&]() { Renderer2D::DrawQuads(span); });
+    state.SetCounter("map_sprites", 1000000);
+    state.SetCounter("drawn", Renderer2D::GetStats().QuadCount);
+}
+
+BENCHMARK("SpriteGrid/Move") {
+    Sprites map = MakeMap(100000);
+    SpriteGrid grid(0.25f);
+    for (size_t i = 0; i < map.Positions.size(); i++) grid.Insert(map.Positions[i], map.Sizes[i]);
+    uint32_t id = 0;
+    float t = 0.0f;
+    while (state.KeepRunning()) {
+        // Small steps, so moves mix staying in the cell with crossing into the next one
+        t += 0.01f;
+        Vec3 position = map.Positions[id];
+        grid.Move(id, {position.x + std::sin(t) * 0.2f, position.y, 0.0f});
+        id = (id + 1) % 100000;
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+// --- Tilemap: same view over growing maps, and the cost of an edit ---
+
+static std::unique_ptr<Tilemap> MakeTilemap(uint32_t size) {
+    // 1/16 unit tiles: the default view shows about 57 x 32 of them
+    auto map = std::make_unique<Tilemap>(size, size, Vec2(1.0f / 16.0f), Vec3(-size / 32.0f, -size / 32.0f, 0.0f));
+    auto sheet = Texture2D::Create(256, 256);
+    std::vector<std::shared_ptr<SubTexture2D>> tiles;
+    for (uint32_t i = 0; i < 256; i++) {
+        tiles.push_back(SubTexture2D::CreateFromCoords(sheet, {float(i % 16), float(i / 16)}, {16.0f, 16.0f}));
+    }
+    map->SetTileset(tiles);
+    std::mt19937 rng(7);
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) map->SetTile(x, y, static_cast<uint16_t>(1 + rng() % 256));
+    }
+    return map;
+}
+
+static void DrawTilemap(Bench::State& state, uint32_t size) {
+    auto map = MakeTilemap(size);
+    RendererScene scene;
+    scene.Measure(state, 1, [&]() { Renderer2D::DrawTilemap(*map); });
+    state.SetCounter("map_tiles", static_cast<double>(size) * size);
+    state.SetCounter("drawn", Renderer2D::GetStats().QuadCount);
+    state.SetCounter("bytes_uploaded", static_cast<double>(Renderer2D::GetStats().BytesUploaded));
+}
+
+BENCHMARK("Tilemap/Draw/256") { DrawTilemap(state, 256); }
+BENCHMARK("Tilemap/Draw/4096") { DrawTilemap(state, 4096); }
+
+// One tile changed per scene: its chunk is rebuilt and re-uploaded
+BENCHMARK("Tilemap/Draw/4096/EditPerFrame") {
+    auto map = MakeTilemap(4096);
+    RendererScene scene;
+    uint16_t tile = 1;
+    scene.Measure(state, 1, [&]() {
+        tile = tile % 256 + 1;
+        map->SetTile(2048, 2048, tile);
+        Renderer2D::DrawTilemap(*map);
+    });
+    state.SetCounter("bytes_uploaded", static_cast<double>(Renderer2D::GetStats().BytesUploaded));
+}
+
+// --- Sprite animation: 200K flipbooks advanced at 60 Hz ---
+
+constexpr size_t ANIMATED_SPRITES = 200000;
+
+// Four 8-frame clips on one 256x256 sheet, instances spread over loop modes, speeds and start times
+static void MakeAnimations(SpriteAnimation& animation, const std::shared_ptr<Texture2D>& sheet) {
+    SpriteAnimation::ClipID clips[4];
+    for (uint32_t row = 0; row < 4; row++) {
+        clips[row] = animation.AddClip(sheet, {32.0f, 32.0f}, {0.0f, 7.0f - row}, 8, 12.0f);
+    }
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> speed(0.5f, 2.0f), time(0.0f, 2.0f);
+    for (size_t i = 0; i < ANIMATED_SPRITES; i++) {
+        animation.Insert(clips[i % 4], static_cast<AnimationLoop>(rng() % 3), speed(rng), time(rng));
+    }
+}
+
+BENCHMARK("SpriteAnimation/Update/200K") {
+    RendererScene scene;
+    SpriteAnimation animation;
+    MakeAnimations(animation, Texture2D::Create(256, 256));
+    while (state.KeepRunning()) {
+        animation.Update(1.0f / 60.0f);
+        Bench::DoNotOptimize(animation.GetFrames());
+    }
+    state.SetItemsProcessed(state.GetIterations() * ANIMATED_SPRITES);
+}
+
+// One tick plus the bulk submission of every animated sprite
+BENCHMARK("SpriteAnimation/UpdateAndDraw/200K") {
+    Sprites sprites(ANIMATED_SPRITES, true);
+    RendererScene scene;
+    SpriteAnimation animation;
+    MakeAnimations(animation, Texture2D::Create(256, 256));
+    QuadSpan span = sprites.Span(false);
+    animation.FillSpan(span);
+    scene.Measure(state, ANIMATED_SPRITES, [&]() {
+        animation.Update(1.0f / 60.0f);
+        Renderer2D::DrawQuads(span);
+    });
+}
+
+// --- Particles: a steady 1M-particle fountain ---
+
+constexpr uint32_t PARTICLE_COUNT = 1000000;
+
+// One emitter with lifetimes in [1.5, 2.5) s at 500K/s, run for 3 s so births and deaths balance
+// around PARTICLE_COUNT
+static void MakeParticles(ParticleSystem& particles) {
+    ParticleEmitter emitter;
+    emitter.Props.Velocity = {0.0f, 1.0f};
+    emitter.Props.VelocityVariation = {1.0f, 0.5f};
+    emitter.Props.ColorBegin = {1.0f, 0.6f, 0.2f, 1.0f};
+    emitter.Props.ColorEnd = {0.2f, 0.2f, 1.0f, 0.0f};
+    emitter.Props.SizeBegin = 0.02f;
+    emitter.Props.SizeVariation = 0.5f;
+    emitter.Props.RotationVariation = 6.28f;
+    emitter.Props.Spin = 1.0f;
+    emitter.Props.SpinVariation = 4.0f;
+    emitter.Props.LifeTime = 2.0f;
+    emitter.Props.LifeTimeVariation = 1.0f;
+    emitter.Rate = PARTICLE_COUNT / 2.0f;
+    particles.AddEmitter(emitter);
+    particles.SetGravity({0.0f, -0.5f});
+    for (int i = 0; i < 180; i++) particles.Update(1.0f / 60.0f);
+}
+
+static void UpdateParticles(Bench::State& state, uint32_t workers) {
+    ParticleSystem particles(PARTICLE_COUNT * 11 / 10);
+    particles.SetWorkerCount(workers);
+    MakeParticles(particles);
+    while (state.KeepRunning()) {
+        particles.Update(1.0f / 60.0f);
+        Bench::DoNotOptimize(particles.GetCount());
+    }
+    state.SetItemsProcessed(state.GetIterations() * particles.GetCount());
+    state.SetCounter("live", particles.GetCount());
+    state.SetCounter("dropped", static_cast<double>(particles.GetDroppedCount()));
+}
+
+BENCHMARK("Particles/Update/1M") { UpdateParticles(state, 1); }
+BENCHMARK("Particles/Update/1M/Threads") { UpdateParticles(state, std::max(std::thread::hardware_concurrency(), 1u)); }
+
+static void DrawFountain(Bench::State& state, QuadPipeline pipeline) {
+    ParticleSystem particles(PARTICLE_COUNT * 11 / 10);
+    MakeParticles(particles);
+    RendererScene scene(TextureMode::Auto, pipeline);
+    scene.Measure(state, particles.GetCount(), [&]() { Renderer2D::DrawParticles(particles); });
+}
+
+BENCHMARK("Particles/Draw/1M/Batched") { DrawFountain(state, QuadPipeline::Batched); }
+BENCHMARK("Particles/Draw/1M/Instanced") { DrawFountain(state, QuadPipeline::Instanced); }
+
+// --- Shapes: selection rings, health bars and debug lines over 100K units ---
+
+constexpr size_t SHAPE_COUNT = 100000;
+
+BENCHMARK("Shapes/Circles/100K/Rings") {
+    Sprites units(SHAPE_COUNT, true);
+    RendererScene scene;
+    scene.Measure(state, SHAPE_COUNT, [&]() {
+        for (size_t i = 0; i < SHAPE_COUNT; i++) {
+            Renderer2D::DrawCircle(units.Positions[i], units.Sizes[i].x, units.Colors[i], units.Sizes[i].x * 0.2f);
+        }
+    });
+}
+
+BENCHMARK("Shapes/RoundedRects/100K/HealthBars") {
+    Sprites units(SHAPE_COUNT, true);
+    RendererScene scene;
+    scene.Measure(state, SHAPE_COUNT, [&]() {
+        for (size_t i = 0; i < SHAPE_COUNT; i++) {
+            const Vec2 size = {units.Sizes[i].x * 2.0f, units.Sizes[i].x * 0.4f};
+            Renderer2D::DrawRoundedRect(units.Positions[i], size, size.y * 0.5f, units.Colors[i]);
+        }
+    });
+}
+
+BENCHMARK("Shapes/Lines/100K") {
+    Sprites units(SHAPE_COUNT, true);
+    RendererScene scene;
+    scene.Measure(state, SHAPE_COUNT, [&]() {
+        for (size_t i = 0; i < SHAPE_COUNT; i++) {
+            const Vec3& from = units.Positions[i];
+            const Vec3 to = {from.x + units.Sizes[i].x * 4.0f, from.y + units.Sizes[i].y, from.z};
+            Renderer2D::DrawLine(from, to, units.Colors[i], 0.004f);
+        }
+    });
+}
+
+// --- Text: HUD-style labels through the SDF glyph path ---
+
+// No font ships with the repo; ENG_BENCH_FONT names any TrueType file
+static std::shared_ptr<Font> LoadBenchFont(Bench::State& state, bool cache = true) {
+    const char* path = std::getenv("ENG_BENCH_FONT");
+    if (!path) {
+        state.SkipWithError("set ENG_BENCH_FONT to a .ttf file");
+        return nullptr;
+    }
+    FontSpec spec;
+    spec.Cache = cache;
+    auto font = Font::Create(path, spec);
+    if (!font) state.SkipWithError(std::string("could not load ") + path);
+    return font;
+}
+
+// Labels at fixed spots, one sprite from a shared sheet under each one
+static void DrawLabels(Bench::State& state, const std::vector<std::string>& labels, size_t perScene, bool rotate) {
+    RendererScene scene;
+    auto font = LoadBenchFont(state);
+    if (!font) return;
+    Sprites sprites(perScene, true);
+    auto sheet = Texture2D::Create(256, 256);
+
+    size_t first = 0, glyphs = 0;
+    scene.Measure(state, perScene, [&]() {
+        glyphs = 0;
+        for (size_t i = 0; i < perScene; i++) {
+            const std::string& label = labels[(first + i) % labels.size()];
+            Renderer2D::DrawQuad(sprites.Positions[i], sprites.Sizes[i], sheet);
+            Renderer2D::DrawString(label, *font, sprites.Positions[i], 0.03f);
+            glyphs += label.size();
+        }
+        if (rotate) first += perScene;
+    });
+    const TextLayoutCache& cache = Renderer2D::GetTextLayoutCache();
+    state.SetCounter("glyphs", static_cast<double>(glyphs));
+    state.SetCounter("layout_hit_rate",
+                     static_cast<double>(cache.GetHits()) / std::max<uint64_t>(cache.GetHits() + cache.GetMisses(), 1));
+}
+
+// Same 1000 unit labels every frame: all layouts come from the cache
+BENCHMARK("Text/DrawString/Labels1K") {
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < 1000; i++) labels.push_back("Unit " + std::to_string(i));
+    DrawLabels(state, labels, 1000, false);
+}
+
+// 1000 fresh damage numbers per frame: every string is laid out, the cache keeps evicting
+BENCHMARK("Text/DrawString/DamageNumbers1K") {
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < 100000; i++) labels.push_back("-" + std::to_string(i));
+    DrawLabels(state, labels, 1000, true);
+}
+
+// Rasterizing the printable ASCII atlas without the disk cache
+BENCHMARK("Font/Bake/ASCII") {
+    RendererScene scene;
+    if (!LoadBenchFont(state, false)) return;
+    while (state.KeepRunning()) {
+        Bench::DoNotOptimize(LoadBenchFont(state, false));
+    }
+    state.SetItemsProcessed(state.GetIterations() * 95);
+}
+
+// --- 1M sprites recorded from one context per hardware thread ---
+
+BENCHMARK("Renderer2D/Contexts/1M") {
+    constexpr size_t COUNT = 1000000;
+    Sprites sprites(COUNT, true);
+    RendererScene scene;
+
+    const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::shared_ptr<Renderer2DContext>> contexts;
+    for (size_t i = 0; i < threadCount; i++) contexts.push_back(Renderer2D::CreateContext());
+
+    const QuadSpan all = sprites.Span(true);
+    scene.Measure(state, COUNT, [&]() {
+        std::vector<std::thread> workers;
+        const size_t chunk = (COUNT + threadCount - 1) / threadCount;
+        for (size_t t = 0; t < threadCount; t++) {
+            workers.emplace_back([&, t]() {
+                const size_t first = t * chunk;
+                QuadSpan span = all;
+                span.Count = std::min(chunk, COUNT - std::min(first, COUNT));
+                span.Positions += first;
+                span.Sizes += first;
+                span.Rotations += first;
+                span.Colors += first;
+                contexts[t]->DrawQuads(span);
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+    });
+    state.SetCounter("threads", static_cast<double>(threadCount));
+}
+
+// --- Render targets: a post chain's intermediates, pooled vs created every frame ---
+
+// One frame of a typical post chain: an HDR scene target, then a horizontal and vertical blur
+// pass ping-ponging between two half-size targets, four times
+template <typename F> static void PostChainFrame(F&& acquire) {
+    FramebufferSpec scene{1920, 1080, {RenderTargetFormat::RGBA16F}, RenderTargetFormat::Depth24Stencil8};
+    FramebufferSpec half{960, 540, {RenderTargetFormat::RGBA16F}};
+
+    std::shared_ptr<Framebuffer> target = acquire(scene);
+    target->Bind();
+    std::shared_ptr<Framebuffer> source = acquire(half);
+    for (int pass = 0; pass < 8; pass++) {
+        std::shared_ptr<Framebuffer> destination = acquire(half);
+        destination->Bind();
+        source->GetColorAttachment()->Bind(0);
+        source = std::move(destination);
+    }
+    target->Unbind();
+}
+
+BENCHMARK("RenderTargetPool/PostChain/Pooled") {
+    RendererScene scene;
+    PostChainFrame(RenderTargetPool::Acquire);
+    RenderTargetPool::EndFrame();
+    while (state.KeepRunning()) {
+        PostChainFrame(RenderTargetPool::Acquire);
+        RenderTargetPool::EndFrame();
+        CaptureRecorder::Clear();
+    }
+    const RenderTargetPoolStats stats = RenderTargetPool::GetStats();
+    state.SetItemsProcessed(state.GetIterations());
+    state.SetCounter("hit_rate", stats.GetHitRate());
+    state.SetCounter("targets", stats.TargetCount);
+    state.SetCounter("bytes_held", static_cast<double>(stats.BytesHeld));
+}
+
+BENCHMARK("RenderTargetPool/PostChain/Create") {
+    RendererScene scene;
+    while (state.KeepRunning()) {
+        PostChainFrame(Framebuffer::Create);
+        CaptureRecorder::Clear();
+    }
+    state.SetItemsProcessed(state.GetIterations());
+}
+
+// --- Post-processing: CPU cost of recording the bloom chain and composite per frame ---
+
+static void PostProcessFrame(Bench::State& state, bool bloom) {
+    RendererScene scene;
+    PostProcess::Init();
+    PostProcess::GetSettings().Bloom = bloom;
+    while (state.KeepRunning()) {
+        PostProcess::BeginFrame(1920, 1080);
+        PostProcess::EndFrame();
+        RenderTargetPool::EndFrame();
+        CaptureRecorder::Clear();
+    }
+    state.SetItemsProcessed(state.GetIterations());
+    state.SetCounter("bloom_mips", PostProcess::GetStats().BloomMips);
+    state.SetCounter("bytes_held", static_cast<double>(RenderTargetPool::GetStats().BytesHeld));
+    PostProcess::GetSettings() = {};
+    PostProcess::Shutdown();
+}
+
+BENCHMARK("PostProcess/Frame/1080p/Bloom") {
+    PostProcessFrame(state, true);
+}
+
+BENCHMARK("PostProcess/Frame/1080p/ToneMapOnly") {
+    PostProcessFrame(state, false);
+}
+
+// --- Vertex expansion kernels alone, for the compiled ISA (see "simd" in the context) ---
+
+static void EmitQuads(Bench::State& state, bool rotated) {
+    Sprites sprites(SCENE_QUADS, true);
+    std::vector<QuadVertex> vertices(SCENE_QUADS * 4);
+
+    QuadKernelInput input;
+    input.Positions = sprites.Positions.data();
+    input.Sizes = sprites.Sizes.data();
+    input.Rotations = rotated ? sprites.Rotations.data() : nullptr;
+    input.Colors = sprites.Colors.data();
+
+    while (state.KeepRunning()) {
+        QuadKernels::EmitQuads(input, 0, SCENE_QUADS, vertices.data());
+        Bench::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetIterations() * SCENE_QUADS);
+}
+
+BENCHMARK("QuadKernels/EmitQuads/Axis") {
+    EmitQuads(state, false);
+}
+
+BENCHMARK("QuadKernels/EmitQuads/Rotated") {
+    EmitQuads(state, true);
+}
@@ -1,8 +1,12 @@
 #include "ExampleLayer.h"
+#include "Engine/Renderer/PostProcess.h"
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/RenderTargetPool.h"
 #include "Engine/Input/Input.h"
 #include "Engine/Input/KeyCodes.h" // 引入 KeyCode 定义
+#include "Engine/Events/KeyEvent.h"
+#include "Engine/Core/Profiler.h"
 
 // 方便使用 Engine 命名空间
 using namespace Engine;
@@ -16,15 +20,62 @@ ExampleLayer::ExampleLayer()
 void ExampleLayer::OnAttach() {
     // 1. 加载 Shader
     // 注意：路径可能需要根据你的运行目录调整，通常是相对于项目根目录或 bin 目录
+    // 片段着色器要与 Renderer2D 的纹理模式匹配 (纹理槽 / 纹理数组)
     m_Shader = Shader::Create(
         "assets/engine/shaders/core_default.vert",
-        "assets/engine/shaders/core_default.frag"
+        Renderer2D::GetTextureMode() == TextureMode::Arrays ? "assets/engine/shaders/core_array.frag"
+                                                            : "assets/engine/shaders/core_default.frag"
     );
 
     // 2. 加载纹理
     m_Texture = Texture2D::Create("assets/game/icons/shader.png");
 
-    // 3. 可以在这里做一些初始设置
+    // 3. 压力测试网格：位置固定，只需生成一次，录制进静态批次
+    // Use integer loop counters to avoid floating-point accumulation errors.
+    const int steps = 100; // (5.0 - -5.0) / 0.1 = 100
+    std::vector<Vec3> positions;
+    positions.reserve(steps * steps);
+    for (int ix = 0; ix < steps; ++ix) {
+        float x = -5.0f + ix * 0.1f;
+        for (int iy = 0; iy < steps; ++iy) {
+            float y = -5.0f + iy * 0.1f;
+            positions.push_back({x, y, 0.0f});
+        }
+    }
+    std::vector<Vec2> sizes(positions.size(), {0.08f, 0.08f});
+
+    QuadSpan grid;
+    grid.Count = positions.size();
+    grid.Positions = positions.data();
+    grid.Sizes = sizes.data();
+    grid.Texture = m_Texture ? m_Texture->GetHandle() : TextureHandle();
+    grid.Color = {0.0f, 0.0f, 1.0f, 0.5f};
+    m_Grid = std::make_shared<StaticBatch>();
+    m_Grid->AddQuads(grid);
+
+    // 4. HUD 字体：仓库不附带字体，把任意 TrueType 字体放到这个路径即可
+    // 第一次运行会生成 SDF 图集并缓存为 default.ttf.sdf，之后直接读取缓存
+    m_Font = Font::Create("assets/engine/fonts/default.ttf");
+
+    // 5. 粒子喷泉：从绿色矩形上方向上喷出，由橙色渐变为透明的蓝色
+    ParticleEmitter fountain;
+    fountain.Props.Position = {0.3f, 0.4f};
+    fountain.Props.Velocity = {0.0f, 1.5f};
+    fountain.Props.VelocityVariation = {1.0f, 0.5f};
+    fountain.Props.ColorBegin = {1.0f, 0.6f, 0.2f, 1.0f};
+    fountain.Props.ColorEnd = {0.2f, 0.3f, 1.0f, 0.0f};
+    fountain.Props.SizeBegin = 0.05f;
+    fountain.Props.SizeVariation = 0.5f;
+    fountain.Props.RotationVariation = 6.28f;
+    fountain.Props.SpinVariation = 4.0f;
+    fountain.Props.LifeTime = 2.0f;
+    fountain.Props.LifeTimeVariation = 1.0f;
+    fountain.Rate = 2000.0f;
+    m_Particles.AddEmitter(fountain);
+    m_Particles.SetGravity({0.0f, -1.0f});
+    m_Particles.SetDepth(0.1f);
+
+    // 6. 可以在这里做一些初始设置
     // m_Shader->Bind(); // 如果需要预绑定
 }
 
@@ -69,9 +120,13 @@ void ExampleLayer::OnUpdate(Timestep ts) {
     m_Camera->SetProjection(aspectRatio, m_CameraZoom);
 
 
+    // 粒子模拟与渲染无关，放在场景外更新
+    m_Particles.Update(ts);
+
     // --- 2. 渲染逻辑 (从原 GameApp::OnRender 迁移) ---
 
-    // 重置统计
+    // 重置统计 (先保留上一帧的数据给 HUD 显示)
+    const RendererStats lastFrame = Renderer2D::GetStats();
     Renderer2D::ResetStats();
 
     // 清屏
@@ -89,26 +144,85 @@ void ExampleLayer::OnUpdate(Timestep ts) {
     // 绿色小矩形
     Renderer2D::DrawQuad({0.2f, 0.2f}, {0.2f, 0.3f}, {0.0f, 1.0f, 0.0f, 1.0f});
 
-    // 压力测试：10000 个蓝色小方块
-    // Use integer loop counters to avoid floating-point accumulation errors.
-    const int steps = 100; // (5.0 - -5.0) / 0.1 = 100
-    for (int ix = 0; ix < steps; ++ix) {
-        float x = -5.0f + ix * 0.1f;
-        for (int iy = 0; iy < steps; ++iy) {
-            float y = -5.0f + iy * 0.1f;
-            Renderer2D::DrawQuad({x, y}, {0.08f, 0.08f}, m_Texture, 1.0f, {0.0f, 0.0f, 1.0f, 0.5f});
-        }
-    }
+    // 压力测试：10000 个蓝色小方块 (静态批次，一次绘制)
+    Renderer2D::DrawStaticBatch(*m_Grid);
 
     // 带纹理的四边形
     if (m_Texture) {
         Renderer2D::DrawQuad({1.0f, 0.0f}, {1.0f, 1.0f}, m_Texture, 1.0f, {1.0f, 1.0f, 1.0f, 1.0f});
     }
 
+    // 解析形状：选中圈、血条和调试线，每种形状各自一个批次
+    Renderer2D::DrawCircle({1.0f, 0.0f, 0.2f}, 0.6f, {1.0f, 0.9f, 0.2f, 1.0f}, 0.04f);
+    Renderer2D::DrawRoundedRect({1.0f, 0.65f, 0.2f}, {0.8f, 0.1f}, 0.05f, {0.2f, 0.2f, 0.2f, 0.8f});
+    Renderer2D::DrawRoundedRect({0.85f, 0.65f, 0.21f}, {0.5f, 0.1f}, 0.05f, {0.2f, 0.9f, 0.3f, 1.0f});
+    Renderer2D::DrawLine({-0.5f, -0.5f, 0.2f}, {1.0f, 0.0f, 0.2f}, {0.0f, 1.0f, 1.0f, 1.0f});
+
+    // 粒子喷泉：直接写入批次缓冲，整体按包围盒剔除
+    Renderer2D::DrawParticles(m_Particles);
+
+    // HUD：上一帧的统计，固定在视野左上角，与其它四边形共用批次
+    if (m_Font) {
+        std::string hud = "Draw calls: " + std::to_string(lastFrame.DrawCalls) +
+                          "\nQuads: " + std::to_string(lastFrame.QuadCount) +
+                          "\nCulled: " + std::to_string(lastFrame.CulledCount);
+        Vec3 corner = {m_CameraPosition.x - aspectRatio * m_CameraZoom + 0.05f * m_CameraZoom,
+                       m_CameraPosition.y + m_CameraZoom - 0.12f * m_CameraZoom, 0.5f};
+        Renderer2D::DrawString(hud, *m_Font, corner, 0.08f * m_CameraZoom);
+    }
+
     // 结束场景
     Renderer2D::EndScene();
 }
 
 void ExampleLayer::OnEvent(Event& event) {
     // 这里可以处理窗口大小变化事件来更新 aspectRatio
+    EventDispatcher dispatcher(event);
+    dispatcher.Dispatch<KeyPressedEvent>([](KeyPressedEvent& e) {
+        // I: 在批处理 / 实例化两条管线之间切换，方便对比
+        if (e.GetKeyCode() == KeyCode::I && e.GetRepeatCount() == 0) {
+            bool instanced = Renderer2D::GetQuadPipeline() == QuadPipeline::Instanced;
+            Renderer2D::SetQuadPipeline(instanced ? QuadPipeline::Batched : QuadPipeline::Instanced);
+            ENG_INFO("Quad pipeline: {0}", instanced ? "Batched" : "Instanced");
+            return true;
+        }
+        // O / B / T: 开关整个后处理 / bloom / 色调映射
+        if (e.GetRepeatCount() == 0) {
+            PostProcessSettings& post = PostProcess::GetSettings();
+            bool* toggle = e.GetKeyCode() == KeyCode::O   ? &post.Enabled
+                           : e.GetKeyCode() == KeyCode::B ? &post.Bloom
+                           : e.GetKeyCode() == KeyCode::T ? &post.ToneMapping
+                                                          : nullptr;
+            if (toggle) {
+                *toggle = !*toggle;
+                ENG_INFO("Post: {0}, bloom {1}, tone mapping {2}", post.Enabled ? "on" : "off",
+                         post.Bloom ? "on" : "off", post.ToneMapping ? "on" : "off");
+                return true;
+            }
+        }
+        // R: 输出最近若干帧的渲染统计 (min / avg / p99 / max) 以及 render target 池的状态
+        if (e.GetKeyCode() == KeyCode::R && e.GetRepeatCount() == 0) {
+            ENG_INFO("{0}", Renderer2D::GetStatsHistory().ToString());
+            const RenderTargetPoolStats pool = RenderTargetPool::GetStats();
+            ENG_INFO("Render targets: {0} held, {1:.1f} MB, hit rate {2:.0f}%", pool.TargetCount,
+                     pool.BytesHeld / (1024.0 * 1024.0), pool.GetHitRate() * 100.0f);
+            const PostProcessStats& post = PostProcess::GetStats();
+            ENG_INFO("Post GPU: downsample {0:.3f} ms, upsample {1:.3f} ms, composite {2:.3f} ms, total {3:.3f} ms "
+                     "({4} bloom mips)",
+                     post.GPUDownsampleTime, post.GPUUpsampleTime, post.GPUCompositeTime, post.GPUTotalTime,
+                     post.BloomMips);
+            return true;
+        }
+        // P: 开始 / 结束一次 profiling 会话，结束时写出 Chrome trace (需要 ENG_PROFILING)
+        if (e.GetKeyCode() == KeyCode::P && e.GetRepeatCount() == 0) {
+            if (Profiler::IsActive()) {
+                Profiler::EndSession("Shader2D-trace.json");
+            } else {
+                Profiler::BeginSession();
+                ENG_INFO("Profiling started, press P again to write Shader2D-trace.json");
+            }
+            return true;
+        }
+        return false;
+    });
 }
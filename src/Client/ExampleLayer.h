@@ -7,10 +7,16 @@
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/Shader.h"
 #include "Engine/Renderer/VertexArray.h"
+#include "Engine/Renderer/StaticBatch.h"
+#include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/ParticleSystem.h"
+#include "Engine/Core/Math.h"
 
 // 包含 glm
 #include <glm/glm.hpp>
 
+#include <vector>
+
 class ExampleLayer : public Engine::Layer {
 public:
     ExampleLayer();
@@ -28,6 +34,15 @@ private:
     std::shared_ptr<Engine::VertexArray> m_VertexArray; // 如果需要的话
     std::shared_ptr<Engine::Texture2D> m_Texture;
 
+    // 压力测试网格：静态批次，只上传一次
+    std::shared_ptr<Engine::StaticBatch> m_Grid;
+
+    // HUD 字体 (SDF 图集)，字体文件不存在时为空
+    std::shared_ptr<Engine::Font> m_Font;
+
+    // 粒子喷泉：固定容量的粒子池，每帧更新后整体提交
+    Engine::ParticleSystem m_Particles{20000};
+
     // 相机系统
     std::shared_ptr<Engine::OrthographicCamera> m_Camera;
     glm::vec3 m_CameraPosition = { 0.0f, 0.0f, 0.0f };
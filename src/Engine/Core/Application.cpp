@@ -1,8 +1,11 @@
 #include "Application.h"
 
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
 #include "Engine/Core/Timestep.h"
+#include "Engine/Renderer/PostProcess.h"
 #include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderTargetPool.h"
 // 临时使用 GLFW 获取时间，后续可以封装到 Platform/Time
 #include <GLFW/glfw3.h> 
 
@@ -11,6 +14,9 @@ namespace Engine {
     Application* Application::s_Instance = nullptr;
 
     Application::Application() {
+        ENG_PROFILE_FUNCTION();
+        ENG_PROFILE_THREAD("Main");
+
         ENG_CORE_ASSERT(!s_Instance, "Application already exists!");
         s_Instance = this;
 
@@ -20,9 +26,11 @@ namespace Engine {
         // 绑定事件回调
         m_Window->SetEventCallback(std::bind(&Application::OnEvent, this, std::placeholders::_1));
         Renderer2D::Init();
+        PostProcess::Init();
     }
 
     Application::~Application() {
+        PostProcess::Shutdown();
     }
 
     void Application::PushLayer(Layer* layer) {
@@ -39,6 +47,7 @@ namespace Engine {
         dispatcher.Dispatch<WindowCloseEvent>(std::bind(&Application::OnWindowClose, this, std::placeholders::_1));
         dispatcher.Dispatch<WindowResizeEvent>(std::bind(&Application::OnWindowResize, this, std::placeholders::_1));
 
+        ENG_PROFILE_SCOPE("LayerStack::OnEvent");
         for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it) {
             if (e.Handled) 
                 break;
@@ -48,16 +57,28 @@ namespace Engine {
 
     void Application::Run() {
         while (m_Running) {
+            ENG_PROFILE_SCOPE("Application::Frame");
+
             float time = (float)glfwGetTime(); 
             Timestep timestep = time - m_LastFrameTime;
             m_LastFrameTime = time;
 
             if (!m_Minimized) {
-                for (Layer* layer : m_LayerStack)
-                    layer->OnUpdate(timestep);
+                // 各层画进 HDR 场景目标，结束时 bloom + 色调映射到窗口
+                PostProcess::BeginFrame(m_Window->GetWidth(), m_Window->GetHeight());
+                {
+                    ENG_PROFILE_SCOPE("LayerStack::OnUpdate");
+                    for (Layer* layer : m_LayerStack)
+                        layer->OnUpdate(timestep);
+                }
+                PostProcess::EndFrame();
             }
+            RenderTargetPool::EndFrame();
 
-            m_Window->OnUpdate();
+            {
+                ENG_PROFILE_SCOPE("Window::OnUpdate");
+                m_Window->OnUpdate();
+            }
         }
     }
 
@@ -1,4 +1,5 @@
 #include "LayerStack.h"
+#include "Engine/Core/Profiler.h"
 #include "pch.h"
 
 namespace Engine {
@@ -10,12 +11,16 @@ LayerStack::~LayerStack() {
 }
 
 void LayerStack::PushLayer(Layer* layer) {
+    ENG_PROFILE_FUNCTION();
+
     m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
     m_LayerInsertIndex++;
     layer->OnAttach();
 }
 
 void LayerStack::PushOverlay(Layer* overlay) {
+    ENG_PROFILE_FUNCTION();
+
     m_Layers.emplace_back(overlay);
     overlay->OnAttach();
 }
@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/packing.hpp>
 // #include <glm/gtx/quaternion.hpp>
 
 #include <algorithm>
@@ -101,5 +102,11 @@ namespace Engine {
         // OpenGL Interop
         template<typename T>
         const float* ValuePtr(const T& v) { return glm::value_ptr(v); }
+
+        // Vertex packing: components are clamped to [0, 1], x lands in the lowest bits
+        inline uint32_t PackUnorm4x8(const Vec4& v) { return glm::packUnorm4x8(v); }
+        inline uint32_t PackUnorm2x16(const Vec2& v) { return glm::packUnorm2x16(v); }
+        inline Vec2 UnpackUnorm2x16(uint32_t v) { return glm::unpackUnorm2x16(v); }
+        inline uint16_t PackHalf(float v) { return glm::packHalf1x16(v); }
     }
 }
\ No newline at end of file
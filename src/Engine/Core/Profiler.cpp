@@ -0,0 +1,239 @@
+#include "Engine/Core/Profiler.h"
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Engine {
+
+namespace {
+
+struct ProfileEvent {
+    const char* Name;
+    uint64_t Start;
+    uint64_t Duration;
+};
+
+constexpr uint32_t CHUNK_EVENTS = 8192; // 192 KB per chunk
+
+struct EventChunk {
+    ProfileEvent Events[CHUNK_EVENTS];
+    std::atomic<EventChunk*> Next{nullptr};
+};
+
+// Written only by its owning thread. The exporter reads Count (release/acquire) and never looks
+// past it, so the owner can keep appending during an export. Chunks are kept between sessions.
+struct ThreadBuffer {
+    uint32_t ThreadID = 0;
+    std::atomic<const char*> Name{nullptr};
+    std::atomic<uint32_t> Generation{0}; // session the events belong to
+    std::atomic<uint64_t> Count{0};
+
+    std::unique_ptr<EventChunk> First = std::make_unique<EventChunk>();
+    EventChunk* Tail = First.get();
+    uint32_t TailCount = 0;
+
+    bool Retired = false; // owner thread exited, the next new thread takes the buffer over
+    bool ClockTimes = false; // events in ClockNow() ns instead of ticks, the GPU track
+
+    ~ThreadBuffer() {
+        EventChunk* chunk = First->Next.load(std::memory_order_relaxed);
+        while (chunk) {
+            EventChunk* next = chunk->Next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+};
+
+struct ProfilerData {
+    std::mutex Mutex; // guards Buffers and Retired, never taken while recording
+    std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+    ThreadBuffer* GPUBuffer = nullptr; // one of Buffers, never retired
+    std::atomic<uint32_t> Generation{0};
+    uint64_t SessionStart = 0;      // ticks
+    uint64_t SessionStartClock = 0; // ns, pairs with SessionStart to calibrate ticks
+};
+
+ProfilerData& GetData() {
+    static ProfilerData data;
+    return data;
+}
+
+// Hands the buffer back when its thread exits, so short-lived threads do not pile up buffers
+struct ThreadBufferHandle {
+    ThreadBuffer* Buffer = nullptr;
+
+    ~ThreadBufferHandle() {
+        if (!Buffer) return;
+        std::lock_guard<std::mutex> lock(GetData().Mutex);
+        Buffer->Retired = true;
+    }
+};
+
+thread_local ThreadBufferHandle t_Buffer;
+
+ThreadBuffer& GetThreadBuffer() {
+    if (t_Buffer.Buffer) return *t_Buffer.Buffer;
+
+    ProfilerData& data = GetData();
+    std::lock_guard<std::mutex> lock(data.Mutex);
+    for (auto& buffer : data.Buffers) {
+        if (buffer->Retired) {
+            buffer->Retired = false;
+            t_Buffer.Buffer = buffer.get();
+            return *buffer;
+        }
+    }
+    data.Buffers.push_back(std::make_unique<ThreadBuffer>());
+    data.Buffers.back()->ThreadID = static_cast<uint32_t>(data.Buffers.size());
+    t_Buffer.Buffer = data.Buffers.back().get();
+    return *t_Buffer.Buffer;
+}
+
+ThreadBuffer& GetGPUBuffer() {
+    ProfilerData& data = GetData();
+    if (data.GPUBuffer) return *data.GPUBuffer;
+
+    std::lock_guard<std::mutex> lock(data.Mutex);
+    data.Buffers.push_back(std::make_unique<ThreadBuffer>());
+    data.GPUBuffer = data.Buffers.back().get();
+    data.GPUBuffer->ThreadID = static_cast<uint32_t>(data.Buffers.size());
+    data.GPUBuffer->Name.store("GPU", std::memory_order_relaxed);
+    data.GPUBuffer->ClockTimes = true;
+    return *data.GPUBuffer;
+}
+
+void Append(ThreadBuffer& buffer, const char* name, uint64_t start, uint64_t end) {
+    const uint32_t generation = GetData().Generation.load(std::memory_order_acquire);
+    if (buffer.Generation.load(std::memory_order_relaxed) != generation) {
+        buffer.Tail = buffer.First.get();
+        buffer.TailCount = 0;
+        buffer.Count.store(0, std::memory_order_relaxed);
+        buffer.Generation.store(generation, std::memory_order_release);
+    }
+
+    if (buffer.TailCount == CHUNK_EVENTS) {
+        EventChunk* next = buffer.Tail->Next.load(std::memory_order_relaxed);
+        if (!next) {
+            next = new EventChunk();
+            buffer.Tail->Next.store(next, std::memory_order_release);
+        }
+        buffer.Tail = next;
+        buffer.TailCount = 0;
+    }
+
+    buffer.Tail->Events[buffer.TailCount++] = {name, start, end - start};
+    buffer.Count.store(buffer.Count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void WriteEscaped(std::ofstream& out, const char* text) {
+    for (; *text; text++) {
+        if (*text == '"' || *text == '\\') out << '\\';
+        out << *text;
+    }
+}
+
+}
+
+std::atomic<bool> Profiler::s_Active{false};
+
+void Profiler::BeginSession() {
+    ProfilerData& data = GetData();
+    if (IsActive()) {
+        ENG_CORE_WARN("Profiler: session already running");
+        return;
+    }
+    // Threads drop their old events on their first record of the new generation
+    data.SessionStart = Now();
+    data.SessionStartClock = ClockNow();
+    data.Generation.fetch_add(1, std::memory_order_release);
+    s_Active.store(true, std::memory_order_release);
+}
+
+bool Profiler::EndSession(const std::string& path) {
+    ProfilerData& data = GetData();
+    if (!IsActive()) return false;
+    s_Active.store(false, std::memory_order_release);
+
+    // Microseconds per tick over the whole session
+    const uint64_t ticks = Now() - data.SessionStart;
+    const uint64_t clock = ClockNow() - data.SessionStartClock;
+    const double usPerTick = ticks > 0 ? clock / 1000.0 / ticks : 0.0;
+
+    std::ofstream out(path);
+    if (!out) {
+        ENG_CORE_ERROR("Profiler: could not write trace {0}", path);
+        return false;
+    }
+
+    const uint32_t generation = data.Generation.load(std::memory_order_acquire);
+    size_t eventCount = 0;
+    bool first = true;
+    char number[64];
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    std::lock_guard<std::mutex> lock(data.Mutex);
+    for (const auto& buffer : data.Buffers) {
+        if (const char* name = buffer->Name.load(std::memory_order_acquire)) {
+            out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+                << buffer->ThreadID << ",\"args\":{\"name\":\"";
+            WriteEscaped(out, name);
+            out << "\"}}";
+            first = false;
+        }
+        if (buffer->Generation.load(std::memory_order_acquire) != generation) continue;
+
+        const uint64_t sessionStart = buffer->ClockTimes ? data.SessionStartClock : data.SessionStart;
+        const double usPerUnit = buffer->ClockTimes ? 0.001 : usPerTick;
+        uint64_t remaining = buffer->Count.load(std::memory_order_acquire);
+        const EventChunk* chunk = buffer->First.get();
+        while (remaining > 0 && chunk) {
+            const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(remaining, CHUNK_EVENTS));
+            for (uint32_t i = 0; i < count; i++) {
+                const ProfileEvent& event = chunk->Events[i];
+                // A scope still open from an earlier session
+                if (event.Start < sessionStart) continue;
+
+                out << (first ? "\n" : ",\n") << "{\"name\":\"";
+                WriteEscaped(out, event.Name);
+                std::snprintf(number, sizeof(number), "%.3f", (event.Start - sessionStart) * usPerUnit);
+                out << "\",\"cat\":\"" << (buffer->ClockTimes ? "gpu" : "cpu") << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                    << buffer->ThreadID << ",\"ts\":" << number;
+                std::snprintf(number, sizeof(number), "%.3f", event.Duration * usPerUnit);
+                out << ",\"dur\":" << number << "}";
+                first = false;
+                eventCount++;
+            }
+            remaining -= count;
+            chunk = chunk->Next.load(std::memory_order_acquire);
+        }
+    }
+    out << "\n]}\n";
+
+    ENG_CORE_INFO("Profiler: wrote {0} events to {1}", eventCount, path);
+    return true;
+}
+
+void Profiler::CancelSession() {
+    // Buffers are reset lazily by the next session's generation bump
+    s_Active.store(false, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name) {
+    GetThreadBuffer().Name.store(name, std::memory_order_release);
+}
+
+void Profiler::Record(const char* name, uint64_t start, uint64_t end) {
+    Append(GetThreadBuffer(), name, start, end);
+}
+
+void Profiler::RecordGPU(const char* name, uint64_t start, uint64_t end) {
+    Append(GetGPUBuffer(), name, start, end);
+}
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ENG_PROFILE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define ENG_PROFILE_TSC
+#endif
+
+namespace Engine {
+
+// Scoped CPU profiler exporting Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+//
+// Scopes are only recorded between BeginSession and EndSession; outside a session a scope costs
+// one relaxed atomic load. Each thread appends to its own chunked event buffer without locks, the
+// exporter reads the published counts, so recording never waits on other threads.
+// Sessions must be started and ended from one thread (normally the main thread), and names must
+// outlive the session: string literals or __PRETTY_FUNCTION__.
+//
+// Build with ENG_ENABLE_PROFILING (CMake option ENG_PROFILING) for the ENG_PROFILE_* macros to
+// expand to anything.
+class Profiler {
+public:
+    static void BeginSession();
+    // Stops recording and writes every event of the session to `path`
+    static bool EndSession(const std::string& path);
+    // Stops recording and drops the session's events
+    static void CancelSession();
+    static bool IsActive() { return s_Active.load(std::memory_order_relaxed); }
+
+    // Label for the calling thread's track in the trace
+    static void SetThreadName(const char* name);
+
+    // Timestamp in ticks. On x86 this is the TSC (invariant on any CPU we target), a clock read
+    // through the OS costs as much as the rest of a scope; ticks are converted to ns on export
+    static uint64_t Now() {
+#ifdef ENG_PROFILE_TSC
+        return __rdtsc();
+#else
+        return ClockNow();
+#endif
+    }
+    static uint64_t ClockNow() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+    static void Record(const char* name, uint64_t start, uint64_t end);
+    // GPU ranges (see GPUTimer) on a separate "GPU" track, times in ClockNow() ns.
+    // Render thread only.
+    static void RecordGPU(const char* name, uint64_t start, uint64_t end);
+
+private:
+    static std::atomic<bool> s_Active;
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_Name(name), m_Active(Profiler::IsActive()) {
+        if (m_Active) m_Start = Profiler::Now();
+    }
+    ~ProfileScope() {
+        if (m_Active) Profiler::Record(m_Name, m_Start, Profiler::Now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    bool m_Active;
+    uint64_t m_Start = 0;
+};
+
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define ENG_FUNC_SIG __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+    #define ENG_FUNC_SIG __FUNCSIG__
+#else
+    #define ENG_FUNC_SIG __func__
+#endif
+
+#ifdef ENG_ENABLE_PROFILING
+    #define ENG_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define ENG_PROFILE_CONCAT(a, b) ENG_PROFILE_CONCAT_IMPL(a, b)
+    #define ENG_PROFILE_SCOPE(name) ::Engine::ProfileScope ENG_PROFILE_CONCAT(profileScope, __LINE__)(name)
+    #define ENG_PROFILE_FUNCTION() ENG_PROFILE_SCOPE(ENG_FUNC_SIG)
+    #define ENG_PROFILE_THREAD(name) ::Engine::Profiler::SetThreadName(name)
+#else
+    #define ENG_PROFILE_SCOPE(name)
+    #define ENG_PROFILE_FUNCTION()
+    #define ENG_PROFILE_THREAD(name)
+#endif
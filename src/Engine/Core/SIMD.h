@@ -0,0 +1,64 @@
+#pragma once
+
+// Build-time SIMD selection for CPU hot paths.
+// CMake defines ENG_SIMD_AVX or ENG_SIMD_SSE from the ENG_SIMD cache option. If the requested
+// instruction set is not available for the target, we quietly fall back to the next one down.
+#if defined(ENG_SIMD_AVX) && defined(__AVX__)
+    #define ENG_SIMD_WIDTH 8
+    #define ENG_SIMD_NAME "AVX"
+    #include <immintrin.h>
+#elif (defined(ENG_SIMD_AVX) || defined(ENG_SIMD_SSE)) && (defined(__SSE2__) || defined(_M_X64))
+    #define ENG_SIMD_WIDTH 4
+    #define ENG_SIMD_NAME "SSE2"
+    #include <emmintrin.h>
+#else
+    #define ENG_SIMD_WIDTH 1
+    #define ENG_SIMD_NAME "Scalar"
+#endif
+
+#if ENG_SIMD_WIDTH > 1
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+namespace SIMD {
+
+    // One register of ENG_SIMD_WIDTH floats and the operations the CPU kernels share.
+    // Loads and stores are unaligned; StoreInt truncates toward zero into aligned int32s.
+#if ENG_SIMD_WIDTH == 8
+    using Lane = __m256;
+    inline Lane Load(const float* p) { return _mm256_loadu_ps(p); }
+    inline void Store(float* p, Lane v) { _mm256_storeu_ps(p, v); }
+    inline Lane Splat(float v) { return _mm256_set1_ps(v); }
+    inline Lane Add(Lane a, Lane b) { return _mm256_add_ps(a, b); }
+    inline Lane Sub(Lane a, Lane b) { return _mm256_sub_ps(a, b); }
+    inline Lane Mul(Lane a, Lane b) { return _mm256_mul_ps(a, b); }
+    inline Lane Min(Lane a, Lane b) { return _mm256_min_ps(a, b); }
+    inline Lane Max(Lane a, Lane b) { return _mm256_max_ps(a, b); }
+    inline Lane Less(Lane a, Lane b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline Lane Select(Lane mask, Lane a, Lane b) { return _mm256_blendv_ps(b, a, mask); }
+    inline int Mask(Lane v) { return _mm256_movemask_ps(v); }
+    inline Lane Truncate(Lane v) { return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(v)); }
+    inline void StoreInt(int32_t* p, Lane v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), _mm256_cvttps_epi32(v)); }
+#else
+    using Lane = __m128;
+    inline Lane Load(const float* p) { return _mm_loadu_ps(p); }
+    inline void Store(float* p, Lane v) { _mm_storeu_ps(p, v); }
+    inline Lane Splat(float v) { return _mm_set1_ps(v); }
+    inline Lane Add(Lane a, Lane b) { return _mm_add_ps(a, b); }
+    inline Lane Sub(Lane a, Lane b) { return _mm_sub_ps(a, b); }
+    inline Lane Mul(Lane a, Lane b) { return _mm_mul_ps(a, b); }
+    inline Lane Min(Lane a, Lane b) { return _mm_min_ps(a, b); }
+    inline Lane Max(Lane a, Lane b) { return _mm_max_ps(a, b); }
+    inline Lane Less(Lane a, Lane b) { return _mm_cmplt_ps(a, b); }
+    inline Lane Select(Lane mask, Lane a, Lane b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    inline int Mask(Lane v) { return _mm_movemask_ps(v); }
+    inline Lane Truncate(Lane v) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(v)); }
+    inline void StoreInt(int32_t* p, Lane v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), _mm_cvttps_epi32(v)); }
+#endif
+
+    constexpr size_t LANES = ENG_SIMD_WIDTH;
+
+} // namespace SIMD
+} // namespace Engine
+#endif
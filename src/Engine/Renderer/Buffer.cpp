@@ -1,12 +1,14 @@
 #include "Engine/Renderer/Buffer.h"
 #include "Engine/Renderer/RendererAPI.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Capture/CaptureBuffer.h"
 
 namespace Engine {
 std::shared_ptr<VertexBuffer> VertexBuffer::Create(uint32_t size) {
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<Engine::OpenGLVertexBuffer>(size);
+        case RendererAPI::API::Capture: return std::make_shared<Engine::CaptureVertexBuffer>(size);
     }
     return nullptr;
 }
@@ -15,6 +17,16 @@ std::shared_ptr<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t siz
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<Engine::OpenGLVertexBuffer>(vertices, size);
+        case RendererAPI::API::Capture: return std::make_shared<Engine::CaptureVertexBuffer>(vertices, size);
+    }
+    return nullptr;
+}
+
+std::shared_ptr<StreamVertexBuffer> StreamVertexBuffer::Create(uint32_t regionSize, uint32_t regionCount) {
+    switch (RendererAPI::GetAPI()) {
+        case RendererAPI::API::None:    return nullptr;
+        case RendererAPI::API::OpenGL:  return std::make_shared<Engine::OpenGLStreamVertexBuffer>(regionSize, regionCount);
+        case RendererAPI::API::Capture: return std::make_shared<Engine::CaptureStreamVertexBuffer>(regionSize, regionCount);
     }
     return nullptr;
 }
@@ -23,6 +35,7 @@ std::shared_ptr<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t cou
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<Engine::OpenGLIndexBuffer>(indices, count);
+        case RendererAPI::API::Capture: return std::make_shared<Engine::CaptureIndexBuffer>(indices, count);
     }
     return nullptr;
 }
@@ -9,9 +9,30 @@
 namespace Engine {
 
 enum class ShaderDataType {
-    None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+    None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+    // Packed types. Set BufferElement::Normalized to read them as [0, 1] floats, otherwise they
+    // are integer attributes (uint / uvec* in the shader). Half is a 16-bit float.
+    UByte, UByte4, UShort, UShort2, UShort4, Half
 };
 
+// Integer attributes are fed through glVertexAttribIPointer unless normalized
+static bool ShaderDataTypeIsInteger(ShaderDataType type) {
+    switch (type) {
+        case ShaderDataType::Int:
+        case ShaderDataType::Int2:
+        case ShaderDataType::Int3:
+        case ShaderDataType::Int4:
+        case ShaderDataType::UByte:
+        case ShaderDataType::UByte4:
+        case ShaderDataType::UShort:
+        case ShaderDataType::UShort2:
+        case ShaderDataType::UShort4:
+            return true;
+        default:
+            return false;
+    }
+}
+
 static uint32_t ShaderDataTypeSize(ShaderDataType type) {
     switch (type) {
         case ShaderDataType::Float:    return 4;
@@ -25,6 +46,12 @@ static uint32_t ShaderDataTypeSize(ShaderDataType type) {
         case ShaderDataType::Int3:     return 4 * 3;
         case ShaderDataType::Int4:     return 4 * 4;
         case ShaderDataType::Bool:     return 1;
+        case ShaderDataType::UByte:    return 1;
+        case ShaderDataType::UByte4:   return 1 * 4;
+        case ShaderDataType::UShort:   return 2;
+        case ShaderDataType::UShort2:  return 2 * 2;
+        case ShaderDataType::UShort4:  return 2 * 4;
+        case ShaderDataType::Half:     return 2;
         case ShaderDataType::None:     break;
     }
     assert(false && "Unknown ShaderDataType!");
@@ -57,6 +84,12 @@ struct BufferElement {
             case ShaderDataType::Int3:    return 3;
             case ShaderDataType::Int4:    return 4;
             case ShaderDataType::Bool:    return 1;
+            case ShaderDataType::UByte:   return 1;
+            case ShaderDataType::UByte4:  return 4;
+            case ShaderDataType::UShort:  return 1;
+            case ShaderDataType::UShort2: return 2;
+            case ShaderDataType::UShort4: return 4;
+            case ShaderDataType::Half:    return 1;
             case ShaderDataType::None:    break;
         }
         assert(false && "Unknown ShaderDataType!");
@@ -68,12 +101,14 @@ class BufferLayout {
 public:
     BufferLayout() {}
 
-    BufferLayout(const std::initializer_list<BufferElement>& elements)
-        : m_Elements(elements) {
+    // instanceDivisor: 0 advances the attributes per vertex, N advances them once every N instances
+    BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t instanceDivisor = 0)
+        : m_Elements(elements), m_InstanceDivisor(instanceDivisor) {
         CalculateOffsetsAndStride();
     }
 
     uint32_t GetStride() const { return m_Stride; }
+    uint32_t GetInstanceDivisor() const { return m_InstanceDivisor; }
     const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
     std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
@@ -95,6 +130,7 @@ private:
 private:
     std::vector<BufferElement> m_Elements;
     uint32_t m_Stride = 0;
+    uint32_t m_InstanceDivisor = 0;
 };
 
 class VertexBuffer {
@@ -104,7 +140,8 @@ public:
     virtual void Bind() const = 0;
     virtual void Unbind() const = 0;
 
-    virtual void SetData(const void* data, uint32_t size) = 0;
+    // Writes `size` bytes at byte `offset`, the buffer keeps its size
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
 
     virtual const BufferLayout& GetLayout() const = 0;
     virtual void SetLayout(const BufferLayout& layout) = 0;
@@ -113,6 +150,28 @@ public:
     static std::shared_ptr<VertexBuffer> Create(float* vertices, uint32_t size);
 };
 
+// Ring of equally sized regions for vertex data that is rewritten every batch.
+// Callers write straight into the region returned by Map(), hand it back with Unmap() and call
+// Fence() once the draw reading it has been issued. A region is only handed out again after the
+// GPU has finished with it, so there is no implicit driver sync and no staging copy.
+class StreamVertexBuffer : public VertexBuffer {
+public:
+    // Write pointer to the current region (GetRegionSize() bytes). Calling Map() again before
+    // Unmap() returns the same region.
+    virtual void* Map() = 0;
+    // Ends the writes to the current region and returns its byte offset in the buffer, to be
+    // turned into a base vertex / base instance for the draw.
+    virtual uint32_t Unmap(uint32_t usedSize) = 0;
+    // Marks the unmapped region as in flight and advances to the next one.
+    virtual void Fence() = 0;
+
+    virtual uint32_t GetRegionSize() const = 0;
+    // Milliseconds the last Map() spent waiting for the GPU to release its region
+    virtual float GetLastWaitTime() const = 0;
+
+    static std::shared_ptr<StreamVertexBuffer> Create(uint32_t regionSize, uint32_t regionCount = 3);
+};
+
 class IndexBuffer {
 public:
     virtual ~IndexBuffer() = default;
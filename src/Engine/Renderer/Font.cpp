@@ -0,0 +1,379 @@
+#include "Font.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Renderer/FontFile.h"
+
+#include "pch.h"
+
+#include <atomic>
+#include <cfloat>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+namespace Engine {
+
+static constexpr uint32_t CACHE_VERSION = 1;
+static constexpr uint32_t ATLAS_PADDING = 1; // empty pixels between glyphs, keeps bilinear taps apart
+
+static std::atomic<uint32_t> s_NextFontID{1};
+
+namespace {
+
+struct Edge {
+    Vec2 A, B;
+};
+
+// A glyph waiting for its distance field: outline in atlas pixels and its block in the atlas
+struct PendingGlyph {
+    uint32_t Glyph; // into Font::m_Glyphs
+    std::vector<Edge> Edges;
+    int32_t X0, Y0; // lower left of the block in glyph space, pixels
+    uint32_t Width, Height;
+    uint32_t AtlasX = 0, AtlasY = 0;
+};
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Font units -> line segments in atlas pixels, flat to within 1/20 pixel
+void Flatten(const std::vector<GlyphCurve>& curves, float scale, std::vector<Edge>& edges) {
+    for (const GlyphCurve& curve : curves) {
+        const Vec2 p0 = curve.P0 * scale;
+        const Vec2 p1 = curve.P1 * scale;
+        const Vec2 p2 = curve.P2 * scale;
+        if (curve.Line) {
+            edges.push_back({p0, p2});
+            continue;
+        }
+        // A quadratic strays at most |p0 - 2 p1 + p2| / (4 n^2) from its n-segment polyline
+        float bend = glm::length(p0 - p1 * 2.0f + p2);
+        uint32_t n = static_cast<uint32_t>(std::ceil(std::sqrt(bend * 5.0f)));
+        n = std::min(std::max(n, 1u), 64u);
+
+        Vec2 prev = p0;
+        for (uint32_t i = 1; i <= n; i++) {
+            float t = static_cast<float>(i) / static_cast<float>(n);
+            float u = 1.0f - t;
+            Vec2 next = p0 * (u * u) + p1 * (2.0f * u * t) + p2 * (t * t);
+            edges.push_back({prev, next});
+            prev = next;
+        }
+    }
+}
+
+// Signed distance at every pixel center of the glyph's block, positive inside, mapped so that
+// 0.5 lies on the outline and 0 / 1 at `spread` pixels out / in. Inside is the nonzero winding
+// rule, evaluated per row from the sorted edge crossings.
+void Rasterize(const PendingGlyph& glyph, float spread, uint8_t* atlas, uint32_t stride) {
+    std::vector<std::pair<float, int32_t>> crossings;
+    const float maxDistance2 = spread * spread;
+
+    for (uint32_t y = 0; y < glyph.Height; y++) {
+        const float py = static_cast<float>(glyph.Y0 + static_cast<int32_t>(y)) + 0.5f;
+        crossings.clear();
+        for (const Edge& edge : glyph.Edges) {
+            if ((edge.A.y <= py) == (edge.B.y <= py)) continue;
+            float x = edge.A.x + (py - edge.A.y) * (edge.B.x - edge.A.x) / (edge.B.y - edge.A.y);
+            crossings.push_back({x, edge.B.y > edge.A.y ? 1 : -1});
+        }
+        std::sort(crossings.begin(), crossings.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        uint8_t* row = atlas + static_cast<size_t>(glyph.AtlasY + y) * stride + glyph.AtlasX;
+        size_t crossing = 0;
+        int32_t winding = 0;
+        for (uint32_t x = 0; x < glyph.Width; x++) {
+            const Vec2 p = {static_cast<float>(glyph.X0 + static_cast<int32_t>(x)) + 0.5f, py};
+            while (crossing < crossings.size() && crossings[crossing].first < p.x) {
+                winding += crossings[crossing++].second;
+            }
+
+            // Nothing beyond the spread is stored, so it is the starting bound
+            float best = maxDistance2;
+            for (const Edge& edge : glyph.Edges) {
+                Vec2 ab = edge.B - edge.A;
+                Vec2 ap = p - edge.A;
+                float length2 = glm::dot(ab, ab);
+                float t = length2 > 0.0f ? std::min(std::max(glm::dot(ap, ab) / length2, 0.0f), 1.0f) : 0.0f;
+                Vec2 d = ap - ab * t;
+                best = std::min(best, glm::dot(d, d));
+            }
+            float distance = std::sqrt(best);
+            if (winding == 0) distance = -distance;
+            float value = 0.5f + distance / (2.0f * spread);
+            row[x] = static_cast<uint8_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+    }
+}
+
+template <typename T> void WriteValue(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> bool ReadValue(std::ifstream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+}
+
+Font::Font() : m_ID(s_NextFontID++) { m_Ascii.fill(-1); }
+
+std::shared_ptr<Font> Font::Create(const std::string& path, const FontSpec& spec) {
+    ENG_PROFILE_FUNCTION();
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        ENG_CORE_ERROR("Font: could not open {0}", path);
+        return nullptr;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // The cache is valid for this exact file and everything in the spec that changes the atlas
+    uint64_t key = HashBytes(data.data(), data.size());
+    const uint32_t settings[] = {CACHE_VERSION, spec.GlyphSize, spec.Spread, spec.AtlasWidth};
+    key = HashBytes(settings, sizeof(settings), key);
+    for (const auto& range : spec.Ranges) key = HashBytes(&range, sizeof(range), key);
+
+    std::shared_ptr<Font> font(new Font());
+    const std::string cachePath = spec.CachePath.empty() ? path + ".sdf" : spec.CachePath;
+    std::vector<uint8_t> distances;
+    if (spec.Cache && font->LoadCache(cachePath, key, distances)) {
+        font->m_FromCache = true;
+    } else {
+        FontFile file;
+        if (!file.Load(std::move(data))) {
+            ENG_CORE_ERROR("Font: {0} is not a TrueType font", path);
+            return nullptr;
+        }
+        if (!font->Bake(file, spec, distances)) {
+            ENG_CORE_ERROR("Font: {0} has none of the requested glyphs", path);
+            return nullptr;
+        }
+        if (spec.Cache) font->SaveCache(cachePath, key, distances);
+    }
+
+    font->Finish(distances);
+    return font;
+}
+
+bool Font::Bake(const FontFile& file, const FontSpec& spec, std::vector<uint8_t>& distances) {
+    ENG_PROFILE_FUNCTION();
+
+    const float emScale = 1.0f / static_cast<float>(file.GetUnitsPerEm());
+    const float pixelScale = spec.GlyphSize * emScale;
+    const float spread = static_cast<float>(std::max(spec.Spread, 1u));
+
+    m_Ascent = file.GetAscent() * emScale;
+    m_Descent = file.GetDescent() * emScale;
+    m_LineHeight = (file.GetAscent() - file.GetDescent() + file.GetLineGap()) * emScale;
+
+    // Outlines first, so the packer knows every block size
+    std::vector<PendingGlyph> pending;
+    std::vector<GlyphCurve> curves;
+    std::unordered_map<uint32_t, uint32_t> fontGlyphToCodepoint;
+    for (const auto& [first, last] : spec.Ranges) {
+        for (uint32_t codepoint = first; codepoint <= last && codepoint <= 0x10FFFF; codepoint++) {
+            uint32_t fontGlyph = file.GetGlyphIndex(codepoint);
+            // Unmapped code points are left out and draw the fallback glyph instead
+            if (fontGlyph == 0 || GetGlyph(codepoint)) continue;
+
+            FontGlyph glyph;
+            glyph.Codepoint = codepoint;
+            glyph.Advance = file.GetAdvance(fontGlyph) * emScale;
+            const uint32_t index = static_cast<uint32_t>(m_Glyphs.size());
+            m_Glyphs.push_back(glyph);
+            if (codepoint < m_Ascii.size()) m_Ascii[codepoint] = static_cast<int32_t>(index);
+            else m_GlyphMap[codepoint] = index;
+            fontGlyphToCodepoint.emplace(fontGlyph, codepoint);
+
+            curves.clear();
+            if (!file.GetOutline(fontGlyph, curves)) continue;
+
+            PendingGlyph block;
+            block.Glyph = index;
+            Flatten(curves, pixelScale, block.Edges);
+            Vec2 min(FLT_MAX), max(-FLT_MAX);
+            for (const Edge& edge : block.Edges) {
+                min = glm::min(min, glm::min(edge.A, edge.B));
+                max = glm::max(max, glm::max(edge.A, edge.B));
+            }
+            block.X0 = static_cast<int32_t>(std::floor(min.x - spread));
+            block.Y0 = static_cast<int32_t>(std::floor(min.y - spread));
+            block.Width = static_cast<uint32_t>(static_cast<int32_t>(std::ceil(max.x + spread)) - block.X0);
+            block.Height = static_cast<uint32_t>(static_cast<int32_t>(std::ceil(max.y + spread)) - block.Y0);
+            pending.push_back(std::move(block));
+        }
+    }
+    if (m_Glyphs.empty()) return false;
+
+    // Shelf packing, tallest first so each shelf wastes little height
+    std::vector<PendingGlyph*> order;
+    for (PendingGlyph& block : pending) order.push_back(&block);
+    std::sort(order.begin(), order.end(), [](const PendingGlyph* a, const PendingGlyph* b) {
+        return a->Height != b->Height ? a->Height > b->Height : a->Width > b->Width;
+    });
+    m_AtlasWidth = spec.AtlasWidth;
+    uint32_t x = ATLAS_PADDING, y = ATLAS_PADDING, shelfHeight = 0;
+    for (PendingGlyph* block : order) {
+        if (block->Width + 2 * ATLAS_PADDING > m_AtlasWidth) {
+            ENG_CORE_WARN("Font: glyph U+{0:04X} is wider than the atlas, skipped",
+                          m_Glyphs[block->Glyph].Codepoint);
+            block->Width = 0;
+            continue;
+        }
+        if (x + block->Width + ATLAS_PADDING > m_AtlasWidth) {
+            x = ATLAS_PADDING;
+            y += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        block->AtlasX = x;
+        block->AtlasY = y;
+        x += block->Width + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, block->Height);
+    }
+    m_AtlasHeight = 16;
+    while (m_AtlasHeight < y + shelfHeight + ATLAS_PADDING) m_AtlasHeight *= 2;
+
+    // Blocks are disjoint, so workers fill them without synchronization
+    distances.assign(static_cast<size_t>(m_AtlasWidth) * m_AtlasHeight, 0);
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        for (size_t i = next++; i < pending.size(); i = next++) {
+            if (pending[i].Width > 0) Rasterize(pending[i], spread, distances.data(), m_AtlasWidth);
+        }
+    };
+    const size_t workerCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), pending.size());
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) workers.emplace_back(work);
+    work();
+    for (std::thread& worker : workers) worker.join();
+
+    const float toEm = 1.0f / spec.GlyphSize;
+    const Vec2 atlasSize = {static_cast<float>(m_AtlasWidth), static_cast<float>(m_AtlasHeight)};
+    for (const PendingGlyph& block : pending) {
+        if (block.Width == 0) continue;
+        FontGlyph& glyph = m_Glyphs[block.Glyph];
+        glyph.Min = Vec2(static_cast<float>(block.X0), static_cast<float>(block.Y0)) * toEm;
+        glyph.Max = Vec2(static_cast<float>(block.X0 + static_cast<int32_t>(block.Width)),
+                         static_cast<float>(block.Y0 + static_cast<int32_t>(block.Height))) * toEm;
+        glyph.UVMin = Vec2(static_cast<float>(block.AtlasX), static_cast<float>(block.AtlasY)) / atlasSize;
+        glyph.UVMax = Vec2(static_cast<float>(block.AtlasX + block.Width),
+                           static_cast<float>(block.AtlasY + block.Height)) / atlasSize;
+    }
+
+    std::vector<FontKerningPair> pairs;
+    file.GetKerningPairs(pairs);
+    for (const FontKerningPair& pair : pairs) {
+        auto left = fontGlyphToCodepoint.find(pair.Left);
+        auto right = fontGlyphToCodepoint.find(pair.Right);
+        if (left == fontGlyphToCodepoint.end() || right == fontGlyphToCodepoint.end() || pair.Value == 0) continue;
+        m_Kerning[(static_cast<uint64_t>(left->second) << 32) | right->second] = pair.Value * emScale;
+    }
+
+    const FontGlyph* question = GetGlyph('?');
+    m_Fallback = question ? static_cast<uint32_t>(question - m_Glyphs.data()) : 0;
+    return true;
+}
+
+// Cache format: header, glyph records, kerning pairs, then the distance bytes. Written in native
+// byte order; it is a local build artifact, not an asset to ship.
+bool Font::LoadCache(const std::string& path, uint64_t key, std::vector<uint8_t>& distances) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    char magic[4];
+    uint64_t cachedKey = 0;
+    uint32_t glyphCount = 0, kerningCount = 0;
+    bool ok = ReadValue(in, magic) && memcmp(magic, "SDFF", 4) == 0 && ReadValue(in, cachedKey) &&
+              cachedKey == key && ReadValue(in, m_Ascent) && ReadValue(in, m_Descent) &&
+              ReadValue(in, m_LineHeight) && ReadValue(in, m_AtlasWidth) && ReadValue(in, m_AtlasHeight) &&
+              ReadValue(in, m_Fallback) && ReadValue(in, glyphCount) && ReadValue(in, kerningCount) &&
+              m_AtlasWidth <= 16384 && m_AtlasHeight <= 16384 && glyphCount > 0 && glyphCount <= 0x110000 &&
+              m_Fallback < glyphCount;
+
+    if (ok) {
+        m_Glyphs.resize(glyphCount);
+        ok = static_cast<bool>(in.read(reinterpret_cast<char*>(m_Glyphs.data()), glyphCount * sizeof(FontGlyph)));
+    }
+    for (uint32_t i = 0; ok && i < kerningCount; i++) {
+        uint64_t pair;
+        float value;
+        ok = ReadValue(in, pair) && ReadValue(in, value);
+        m_Kerning[pair] = value;
+    }
+    if (ok) {
+        distances.resize(static_cast<size_t>(m_AtlasWidth) * m_AtlasHeight);
+        ok = static_cast<bool>(in.read(reinterpret_cast<char*>(distances.data()), distances.size()));
+    }
+    if (!ok) {
+        m_Glyphs.clear();
+        m_Kerning.clear();
+        return false;
+    }
+
+    for (uint32_t i = 0; i < glyphCount; i++) {
+        uint32_t codepoint = m_Glyphs[i].Codepoint;
+        if (codepoint < m_Ascii.size()) m_Ascii[codepoint] = static_cast<int32_t>(i);
+        else m_GlyphMap[codepoint] = i;
+    }
+    return true;
+}
+
+void Font::SaveCache(const std::string& path, uint64_t key, const std::vector<uint8_t>& distances) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        ENG_CORE_WARN("Font: could not write atlas cache {0}", path);
+        return;
+    }
+
+    out.write("SDFF", 4);
+    WriteValue(out, key);
+    WriteValue(out, m_Ascent);
+    WriteValue(out, m_Descent);
+    WriteValue(out, m_LineHeight);
+    WriteValue(out, m_AtlasWidth);
+    WriteValue(out, m_AtlasHeight);
+    WriteValue(out, m_Fallback);
+    WriteValue(out, static_cast<uint32_t>(m_Glyphs.size()));
+    WriteValue(out, static_cast<uint32_t>(m_Kerning.size()));
+    out.write(reinterpret_cast<const char*>(m_Glyphs.data()), m_Glyphs.size() * sizeof(FontGlyph));
+    for (const auto& [pair, value] : m_Kerning) {
+        WriteValue(out, pair);
+        WriteValue(out, value);
+    }
+    out.write(reinterpret_cast<const char*>(distances.data()), distances.size());
+}
+
+void Font::Finish(const std::vector<uint8_t>& distances) {
+    // RGBA8 like every other texture, so the atlas also fits the TextureArrayPool; the shaders
+    // read the distance from alpha
+    std::vector<uint8_t> pixels(distances.size() * 4, 255);
+    for (size_t i = 0; i < distances.size(); i++) pixels[i * 4 + 3] = distances[i];
+
+    m_Texture = Texture2D::Create(m_AtlasWidth, m_AtlasHeight);
+    m_Texture->SetData(pixels.data(), static_cast<uint32_t>(pixels.size()));
+}
+
+const FontGlyph* Font::GetGlyph(uint32_t codepoint) const {
+    if (codepoint < m_Ascii.size()) {
+        int32_t index = m_Ascii[codepoint];
+        return index >= 0 ? &m_Glyphs[index] : nullptr;
+    }
+    auto it = m_GlyphMap.find(codepoint);
+    return it != m_GlyphMap.end() ? &m_Glyphs[it->second] : nullptr;
+}
+
+float Font::GetKerning(uint32_t left, uint32_t right) const {
+    auto it = m_Kerning.find((static_cast<uint64_t>(left) << 32) | right);
+    return it != m_Kerning.end() ? it->second : 0.0f;
+}
+
+}
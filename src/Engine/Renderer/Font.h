@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+#include "Engine/Renderer/Texture.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+class FontFile;
+
+struct FontSpec {
+    // Atlas pixels per em. Sets the quality of the distance field, not the size text is drawn at.
+    uint32_t GlyphSize = 48;
+    // Distance range in atlas pixels on either side of the outline
+    uint32_t Spread = 6;
+    uint32_t AtlasWidth = 1024;
+    // Inclusive code point ranges baked into the atlas
+    std::vector<std::pair<uint32_t, uint32_t>> Ranges = {{0x20, 0x7E}};
+    // The baked atlas is written next to the font as <path>.sdf unless a path is given here
+    bool Cache = true;
+    std::string CachePath;
+};
+
+// In ems, relative to the pen position on the baseline, y up
+struct FontGlyph {
+    uint32_t Codepoint = 0;
+    Vec2 Min = Vec2(0.0f); // quad, including the distance field spread
+    Vec2 Max = Vec2(0.0f);
+    Vec2 UVMin = Vec2(0.0f);
+    Vec2 UVMax = Vec2(0.0f);
+    float Advance = 0.0f;
+
+    bool IsEmpty() const { return Max.x <= Min.x; }
+};
+
+// A TrueType font baked into a signed distance field atlas: the texture's alpha holds the
+// distance to the outline, 0.5 on the edge, so the shaders can rebuild a sharp edge at any
+// scale. Glyphs are rasterized once per FontSpec; the result is cached to disk and reused while
+// the font file and the spec are unchanged. Create after Renderer2D::Init so the atlas texture
+// is pooled in TextureMode::Arrays.
+class Font {
+public:
+    // nullptr if the file cannot be read or is not a TrueType font
+    static std::shared_ptr<Font> Create(const std::string& path, const FontSpec& spec = FontSpec());
+
+    // Null for code points outside the baked ranges
+    const FontGlyph* GetGlyph(uint32_t codepoint) const;
+    // Drawn for missing code points: '?' when baked, otherwise the first glyph
+    const FontGlyph& GetFallbackGlyph() const { return m_Glyphs[m_Fallback]; }
+    // Legacy 'kern' table pairs only, in ems
+    float GetKerning(uint32_t left, uint32_t right) const;
+    bool HasKerning() const { return !m_Kerning.empty(); }
+
+    float GetAscent() const { return m_Ascent; }
+    float GetDescent() const { return m_Descent; }
+    float GetLineHeight() const { return m_LineHeight; }
+
+    const std::shared_ptr<Texture2D>& GetAtlasTexture() const { return m_Texture; }
+    uint32_t GetGlyphCount() const { return static_cast<uint32_t>(m_Glyphs.size()); }
+    // Unique per Font object, never reused; keys layout caches
+    uint32_t GetID() const { return m_ID; }
+    bool IsFromCache() const { return m_FromCache; }
+
+private:
+    Font();
+
+    bool Bake(const FontFile& file, const FontSpec& spec, std::vector<uint8_t>& distances);
+    bool LoadCache(const std::string& path, uint64_t key, std::vector<uint8_t>& distances);
+    void SaveCache(const std::string& path, uint64_t key, const std::vector<uint8_t>& distances) const;
+    void Finish(const std::vector<uint8_t>& distances);
+
+    uint32_t m_ID;
+    std::vector<FontGlyph> m_Glyphs;
+    std::array<int32_t, 128> m_Ascii; // index into m_Glyphs or -1, skips the map for ASCII
+    std::unordered_map<uint32_t, uint32_t> m_GlyphMap;
+    std::unordered_map<uint64_t, float> m_Kerning; // (left << 32 | right) code points
+    uint32_t m_Fallback = 0;
+
+    float m_Ascent = 0.0f;
+    float m_Descent = 0.0f;
+    float m_LineHeight = 0.0f;
+
+    uint32_t m_AtlasWidth = 0;
+    uint32_t m_AtlasHeight = 0;
+    std::shared_ptr<Texture2D> m_Texture;
+    bool m_FromCache = false;
+};
+
+}
@@ -0,0 +1,344 @@
+#include "FontFile.h"
+
+#include "pch.h"
+
+#include <cstring>
+
+namespace Engine {
+
+// Big-endian reads; anything past the end of the file reads as zero, so a truncated or corrupt
+// font produces garbage glyphs at worst, never an out-of-bounds access
+static uint32_t U8(const std::vector<uint8_t>& data, size_t offset) { return offset < data.size() ? data[offset] : 0; }
+
+static uint32_t U16(const std::vector<uint8_t>& data, size_t offset) {
+    return (U8(data, offset) << 8) | U8(data, offset + 1);
+}
+
+static int32_t I16(const std::vector<uint8_t>& data, size_t offset) {
+    return static_cast<int16_t>(U16(data, offset));
+}
+
+static uint32_t U32(const std::vector<uint8_t>& data, size_t offset) {
+    return (U16(data, offset) << 16) | U16(data, offset + 2);
+}
+
+// 2.14 fixed point, used by composite glyph scales
+static float F2Dot14(const std::vector<uint8_t>& data, size_t offset) { return I16(data, offset) / 16384.0f; }
+
+bool FontFile::Load(std::vector<uint8_t> data) {
+    m_Data = std::move(data);
+
+    uint32_t version = U32(m_Data, 0);
+    if (version != 0x00010000 && version != 0x74727565) return false; // 1.0 or 'true'
+
+    uint32_t head = FindTable("head");
+    uint32_t hhea = FindTable("hhea");
+    uint32_t maxp = FindTable("maxp");
+    uint32_t cmap = FindTable("cmap");
+    m_Hmtx = FindTable("hmtx");
+    m_Loca = FindTable("loca");
+    m_Glyf = FindTable("glyf", &m_GlyfLength);
+    if (!head || !hhea || !maxp || !cmap || !m_Hmtx || !m_Loca || !m_Glyf) return false;
+
+    m_UnitsPerEm = U16(m_Data, head + 18);
+    m_LongLoca = I16(m_Data, head + 50) != 0;
+    m_GlyphCount = U16(m_Data, maxp + 4);
+    m_Ascent = I16(m_Data, hhea + 4);
+    m_Descent = I16(m_Data, hhea + 6);
+    m_LineGap = I16(m_Data, hhea + 8);
+    m_HMetricCount = U16(m_Data, hhea + 34);
+    if (m_UnitsPerEm == 0 || m_HMetricCount == 0) return false;
+
+    // Prefer a full Unicode table (format 12) over the BMP-only format 4
+    uint32_t best = 0;
+    for (uint32_t i = 0, count = U16(m_Data, cmap + 2); i < count; i++) {
+        size_t record = cmap + 4 + i * 8;
+        uint32_t platform = U16(m_Data, record);
+        uint32_t encoding = U16(m_Data, record + 2);
+        uint32_t subtable = cmap + U32(m_Data, record + 4);
+        uint32_t format = U16(m_Data, subtable);
+        bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+        uint32_t score = !unicode ? 0 : format == 12 ? 2 : format == 4 ? 1 : 0;
+        if (score > best) {
+            best = score;
+            m_Cmap = subtable;
+            m_CmapFormat = format;
+        }
+    }
+    if (best == 0) return false;
+
+    uint32_t kern = FindTable("kern");
+    if (kern && U16(m_Data, kern) == 0) {
+        size_t subtable = kern + 4;
+        for (uint32_t i = 0, count = U16(m_Data, kern + 2); i < count; i++) {
+            uint32_t coverage = U16(m_Data, subtable + 4);
+            // Format 0, horizontal, not cross-stream
+            if ((coverage >> 8) == 0 && (coverage & 0x5) == 0x1) {
+                m_Kern = static_cast<uint32_t>(subtable);
+                break;
+            }
+            subtable += U16(m_Data, subtable + 2);
+        }
+    }
+    return true;
+}
+
+uint32_t FontFile::FindTable(const char* tag, uint32_t* length) const {
+    for (uint32_t i = 0, count = U16(m_Data, 4); i < count; i++) {
+        size_t record = 12 + i * 16;
+        if (record + 16 > m_Data.size()) break;
+        if (memcmp(m_Data.data() + record, tag, 4) != 0) continue;
+
+        uint32_t offset = U32(m_Data, record + 8);
+        uint32_t size = U32(m_Data, record + 12);
+        if (static_cast<size_t>(offset) + size > m_Data.size()) return 0;
+        if (length) *length = size;
+        return offset;
+    }
+    return 0;
+}
+
+uint32_t FontFile::GetGlyphIndex(uint32_t codepoint) const {
+    uint32_t glyph = 0;
+    if (m_CmapFormat == 12) {
+        uint32_t lo = 0, hi = U32(m_Data, m_Cmap + 12);
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            size_t group = m_Cmap + 16 + static_cast<size_t>(mid) * 12;
+            if (codepoint < U32(m_Data, group)) {
+                hi = mid;
+            } else if (codepoint > U32(m_Data, group + 4)) {
+                lo = mid + 1;
+            } else {
+                glyph = U32(m_Data, group + 8) + codepoint - U32(m_Data, group);
+                break;
+            }
+        }
+    } else if (codepoint <= 0xFFFF) {
+        // Format 4: segments sorted by end code, each with a delta or an offset into a glyph array
+        uint32_t segCountX2 = U16(m_Data, m_Cmap + 6);
+        size_t endCodes = m_Cmap + 14;
+        size_t startCodes = endCodes + segCountX2 + 2;
+        size_t deltas = startCodes + segCountX2;
+        size_t rangeOffsets = deltas + segCountX2;
+
+        uint32_t lo = 0, hi = segCountX2 / 2;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            if (U16(m_Data, endCodes + mid * 2) < codepoint) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo < segCountX2 / 2 && codepoint >= U16(m_Data, startCodes + lo * 2)) {
+            uint32_t delta = U16(m_Data, deltas + lo * 2);
+            uint32_t rangeOffset = U16(m_Data, rangeOffsets + lo * 2);
+            if (rangeOffset == 0) {
+                glyph = (codepoint + delta) & 0xFFFF;
+            } else {
+                size_t address = rangeOffsets + lo * 2 + rangeOffset +
+                                 (codepoint - U16(m_Data, startCodes + lo * 2)) * 2;
+                uint32_t value = U16(m_Data, address);
+                glyph = value ? (value + delta) & 0xFFFF : 0;
+            }
+        }
+    }
+    return glyph < m_GlyphCount ? glyph : 0;
+}
+
+int32_t FontFile::GetAdvance(uint32_t glyph) const {
+    uint32_t metric = std::min(glyph, m_HMetricCount - 1);
+    return static_cast<int32_t>(U16(m_Data, m_Hmtx + static_cast<size_t>(metric) * 4));
+}
+
+void FontFile::GetKerningPairs(std::vector<FontKerningPair>& pairs) const {
+    if (!m_Kern) return;
+
+    const uint32_t count = U16(m_Data, m_Kern + 6);
+    pairs.reserve(pairs.size() + count);
+    for (uint32_t i = 0; i < count; i++) {
+        size_t pair = m_Kern + 14 + static_cast<size_t>(i) * 6;
+        pairs.push_back({U16(m_Data, pair), U16(m_Data, pair + 2), I16(m_Data, pair + 4)});
+    }
+}
+
+bool FontFile::GetGlyphRange(uint32_t glyph, uint32_t& offset, uint32_t& length) const {
+    if (glyph >= m_GlyphCount) return false;
+
+    uint32_t start, end;
+    if (m_LongLoca) {
+        start = U32(m_Data, m_Loca + static_cast<size_t>(glyph) * 4);
+        end = U32(m_Data, m_Loca + static_cast<size_t>(glyph) * 4 + 4);
+    } else {
+        start = U16(m_Data, m_Loca + static_cast<size_t>(glyph) * 2) * 2;
+        end = U16(m_Data, m_Loca + static_cast<size_t>(glyph) * 2 + 2) * 2;
+    }
+    // Equal offsets mean a glyph without outline
+    if (end <= start || end > m_GlyfLength) return false;
+    offset = m_Glyf + start;
+    length = end - start;
+    return true;
+}
+
+bool FontFile::GetOutline(uint32_t glyph, std::vector<GlyphCurve>& curves) const {
+    const float identity[6] = {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+    size_t before = curves.size();
+    AppendOutline(glyph, identity, curves, 0);
+    return curves.size() > before;
+}
+
+// transform maps (x, y) to (t0 x + t2 y + t4, t1 x + t3 y + t5)
+bool FontFile::AppendOutline(uint32_t glyph, const float transform[6], std::vector<GlyphCurve>& curves,
+                             uint32_t depth) const {
+    uint32_t offset, length;
+    if (depth > 8 || !GetGlyphRange(glyph, offset, length)) return false;
+
+    const int32_t contourCount = I16(m_Data, offset);
+    if (contourCount < 0) {
+        // Composite: other glyphs placed with an offset and an optional 2x2 matrix
+        size_t p = offset + 10;
+        uint32_t flags;
+        do {
+            flags = U16(m_Data, p);
+            uint32_t component = U16(m_Data, p + 2);
+            p += 4;
+
+            float dx, dy;
+            if (flags & 0x1) { // ARG_1_AND_2_ARE_WORDS
+                dx = static_cast<float>(I16(m_Data, p));
+                dy = static_cast<float>(I16(m_Data, p + 2));
+                p += 4;
+            } else {
+                dx = static_cast<float>(static_cast<int8_t>(U8(m_Data, p)));
+                dy = static_cast<float>(static_cast<int8_t>(U8(m_Data, p + 1)));
+                p += 2;
+            }
+            if (!(flags & 0x2)) dx = dy = 0.0f; // point-matched placement is not supported
+
+            float m[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+            if (flags & 0x8) { // WE_HAVE_A_SCALE
+                m[0] = m[3] = F2Dot14(m_Data, p);
+                p += 2;
+            } else if (flags & 0x40) { // WE_HAVE_AN_X_AND_Y_SCALE
+                m[0] = F2Dot14(m_Data, p);
+                m[3] = F2Dot14(m_Data, p + 2);
+                p += 4;
+            } else if (flags & 0x80) { // WE_HAVE_A_TWO_BY_TWO
+                for (size_t i = 0; i < 4; i++) m[i] = F2Dot14(m_Data, p + i * 2);
+                p += 8;
+            }
+
+            const float* t = transform;
+            const float child[6] = {
+                t[0] * m[0] + t[2] * m[1], t[1] * m[0] + t[3] * m[1],
+                t[0] * m[2] + t[2] * m[3], t[1] * m[2] + t[3] * m[3],
+                t[0] * dx + t[2] * dy + t[4], t[1] * dx + t[3] * dy + t[5],
+            };
+            AppendOutline(component, child, curves, depth + 1);
+        } while (flags & 0x20); // MORE_COMPONENTS
+        return true;
+    }
+    if (contourCount == 0) return true;
+
+    // Simple glyph: contour end points, instructions, then run-length encoded flags and
+    // delta-encoded x and y coordinates
+    const size_t endPoints = offset + 10;
+    const uint32_t pointCount = U16(m_Data, endPoints + (contourCount - 1) * 2) + 1;
+    size_t p = endPoints + contourCount * 2;
+    p += 2 + U16(m_Data, p);
+    if (p + pointCount > offset + length) return false;
+
+    std::vector<uint8_t> flags(pointCount);
+    for (uint32_t i = 0; i < pointCount;) {
+        uint8_t flag = static_cast<uint8_t>(U8(m_Data, p++));
+        flags[i++] = flag;
+        if (flag & 0x8) { // REPEAT_FLAG
+            for (uint32_t repeat = U8(m_Data, p++); repeat > 0 && i < pointCount; repeat--) flags[i++] = flag;
+        }
+    }
+
+    std::vector<Vec2> points(pointCount);
+    int32_t value = 0;
+    for (uint32_t i = 0; i < pointCount; i++) {
+        uint8_t flag = flags[i];
+        if (flag & 0x2) {
+            int32_t delta = static_cast<int32_t>(U8(m_Data, p++));
+            value += (flag & 0x10) ? delta : -delta;
+        } else if (!(flag & 0x10)) {
+            value += I16(m_Data, p);
+            p += 2;
+        }
+        points[i].x = static_cast<float>(value);
+    }
+    value = 0;
+    for (uint32_t i = 0; i < pointCount; i++) {
+        uint8_t flag = flags[i];
+        if (flag & 0x4) {
+            int32_t delta = static_cast<int32_t>(U8(m_Data, p++));
+            value += (flag & 0x20) ? delta : -delta;
+        } else if (!(flag & 0x20)) {
+            value += I16(m_Data, p);
+            p += 2;
+        }
+        points[i].y = static_cast<float>(value);
+    }
+    for (Vec2& point : points) {
+        point = {transform[0] * point.x + transform[2] * point.y + transform[4],
+                 transform[1] * point.x + transform[3] * point.y + transform[5]};
+    }
+
+    // Two consecutive off-curve points imply an on-curve point halfway between them
+    uint32_t first = 0;
+    for (int32_t c = 0; c < contourCount; c++) {
+        uint32_t last = std::min(U16(m_Data, endPoints + c * 2), pointCount - 1);
+        if (last < first) break;
+        const uint32_t n = last - first + 1;
+        auto onCurve = [&](uint32_t i) { return (flags[first + i] & 0x1) != 0; };
+        auto point = [&](uint32_t i) { return points[first + i]; };
+
+        // Start on an on-curve point; if there is none at either end, at the implied one
+        // between the last and the first point
+        Vec2 start;
+        uint32_t begin, count;
+        if (onCurve(0)) {
+            start = point(0);
+            begin = 1;
+            count = n - 1;
+        } else if (onCurve(n - 1)) {
+            start = point(n - 1);
+            begin = 0;
+            count = n - 1;
+        } else {
+            start = (point(0) + point(n - 1)) * 0.5f;
+            begin = 0;
+            count = n;
+        }
+
+        Vec2 current = start;
+        Vec2 control;
+        bool hasControl = false;
+        auto emit = [&](const Vec2& to) {
+            if (hasControl) {
+                curves.push_back({current, control, to, false});
+            } else if (to != current) {
+                curves.push_back({current, (current + to) * 0.5f, to, true});
+            }
+            current = to;
+            hasControl = false;
+        };
+        for (uint32_t k = 0; k <= count && n > 1; k++) {
+            // The extra step closes the contour back at the start point
+            bool on = k == count || onCurve(begin + k);
+            Vec2 next = k == count ? start : point(begin + k);
+            if (on) {
+                emit(next);
+            } else {
+                if (hasControl) emit((control + next) * 0.5f);
+                control = next;
+                hasControl = true;
+            }
+        }
+        first = last + 1;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// One outline piece in font units, y up. Lines have P1 at the midpoint of P0 and P2.
+struct GlyphCurve {
+    Vec2 P0, P1, P2;
+    bool Line;
+};
+
+struct FontKerningPair {
+    uint32_t Left, Right; // glyph indices
+    int32_t Value;        // font units
+};
+
+// Minimal reader for TrueType outline fonts (.ttf): cmap formats 4 and 12, horizontal metrics,
+// the legacy 'kern' table, and simple and composite glyphs. CFF-based OpenType fonts and GPOS
+// kerning are not supported. Only what Font needs to rasterize glyphs is exposed.
+class FontFile {
+public:
+    // Takes the whole file; false if it is not a TrueType font this reader understands
+    bool Load(std::vector<uint8_t> data);
+
+    const std::vector<uint8_t>& GetData() const { return m_Data; }
+
+    uint32_t GetUnitsPerEm() const { return m_UnitsPerEm; }
+    int32_t GetAscent() const { return m_Ascent; }
+    int32_t GetDescent() const { return m_Descent; } // negative, below the baseline
+    int32_t GetLineGap() const { return m_LineGap; }
+
+    // 0 (.notdef) for code points the font does not map
+    uint32_t GetGlyphIndex(uint32_t codepoint) const;
+    int32_t GetAdvance(uint32_t glyph) const;
+    // Every pair of the 'kern' table, for building a lookup over the glyphs actually used
+    void GetKerningPairs(std::vector<FontKerningPair>& pairs) const;
+
+    // Appends the glyph's closed contours; false for empty glyphs such as the space
+    bool GetOutline(uint32_t glyph, std::vector<GlyphCurve>& curves) const;
+
+private:
+    uint32_t FindTable(const char* tag, uint32_t* length = nullptr) const;
+    bool GetGlyphRange(uint32_t glyph, uint32_t& offset, uint32_t& length) const;
+    bool AppendOutline(uint32_t glyph, const float transform[6], std::vector<GlyphCurve>& curves,
+                       uint32_t depth) const;
+
+    std::vector<uint8_t> m_Data;
+    uint32_t m_UnitsPerEm = 0;
+    int32_t m_Ascent = 0;
+    int32_t m_Descent = 0;
+    int32_t m_LineGap = 0;
+    uint32_t m_GlyphCount = 0;
+    uint32_t m_HMetricCount = 0;
+    bool m_LongLoca = false;
+
+    uint32_t m_Cmap = 0; // offset of the chosen subtable
+    uint32_t m_CmapFormat = 0;
+    uint32_t m_Loca = 0;
+    uint32_t m_Glyf = 0;
+    uint32_t m_GlyfLength = 0;
+    uint32_t m_Hmtx = 0;
+    uint32_t m_Kern = 0; // first horizontal format 0 subtable, 0 if none
+};
+
+}
@@ -0,0 +1,64 @@
+#include "Engine/Renderer/Framebuffer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Core/Log.h"
+#include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Platform/Capture/CaptureFramebuffer.h"
+
+namespace Engine {
+
+uint32_t GetRenderTargetFormatSize(RenderTargetFormat format) {
+    switch (format) {
+        case RenderTargetFormat::None:            return 0;
+        case RenderTargetFormat::RGBA8:           return 4;
+        case RenderTargetFormat::RGBA16F:         return 8;
+        case RenderTargetFormat::R11G11B10F:      return 4;
+        case RenderTargetFormat::Depth24Stencil8: return 4;
+    }
+    return 0;
+}
+
+bool IsDepthFormat(RenderTargetFormat format) { return format == RenderTargetFormat::Depth24Stencil8; }
+
+uint64_t Framebuffer::GetMemorySize() const {
+    uint64_t bytesPerPixel = GetRenderTargetFormatSize(m_Spec.DepthAttachment);
+    for (RenderTargetFormat format : m_Spec.ColorAttachments) bytesPerPixel += GetRenderTargetFormatSize(format);
+    return static_cast<uint64_t>(m_Spec.Width) * m_Spec.Height * bytesPerPixel;
+}
+
+static bool ValidateSpec(const FramebufferSpec& spec) {
+    const uint32_t maxSize = RenderCommand::GetCaps().MaxTextureSize;
+    if (spec.Width == 0 || spec.Height == 0 || (maxSize && (spec.Width > maxSize || spec.Height > maxSize))) {
+        ENG_CORE_ERROR("Framebuffer: invalid size {0}x{1}", spec.Width, spec.Height);
+        return false;
+    }
+    if (spec.ColorAttachments.size() > Framebuffer::MAX_COLOR_ATTACHMENTS) {
+        ENG_CORE_ERROR("Framebuffer: {0} color attachments, at most {1}", spec.ColorAttachments.size(),
+                       Framebuffer::MAX_COLOR_ATTACHMENTS);
+        return false;
+    }
+    for (RenderTargetFormat format : spec.ColorAttachments) {
+        if (format == RenderTargetFormat::None || IsDepthFormat(format)) {
+            ENG_CORE_ERROR("Framebuffer: color attachments need a color format");
+            return false;
+        }
+    }
+    if (spec.DepthAttachment != RenderTargetFormat::None && !IsDepthFormat(spec.DepthAttachment)) {
+        ENG_CORE_ERROR("Framebuffer: the depth attachment needs a depth format");
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<Framebuffer> Framebuffer::Create(const FramebufferSpec& spec) {
+    if (!ValidateSpec(spec)) return nullptr;
+
+    switch (RendererAPI::GetAPI()) {
+        case RendererAPI::API::None:    return nullptr;
+        case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLFramebuffer>(spec);
+        case RendererAPI::API::Capture: return std::make_shared<CaptureFramebuffer>(spec);
+    }
+    return nullptr;
+}
+
+}
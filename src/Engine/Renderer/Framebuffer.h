@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Engine/Renderer/Texture.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+// Pixel format of a Framebuffer attachment
+enum class RenderTargetFormat : uint8_t {
+    None = 0,
+    RGBA8,
+    RGBA16F,    // HDR color
+    R11G11B10F, // HDR color in half the memory, no alpha
+    Depth24Stencil8
+};
+
+uint32_t GetRenderTargetFormatSize(RenderTargetFormat format); // bytes per pixel
+bool IsDepthFormat(RenderTargetFormat format);
+
+struct FramebufferSpec {
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    // One per draw buffer, fragment output `location = i` writes attachment i
+    std::vector<RenderTargetFormat> ColorAttachments = {RenderTargetFormat::RGBA8};
+    RenderTargetFormat DepthAttachment = RenderTargetFormat::None;
+
+    bool operator==(const FramebufferSpec& other) const {
+        return Width == other.Width && Height == other.Height && ColorAttachments == other.ColorAttachments &&
+               DepthAttachment == other.DepthAttachment;
+    }
+    bool operator!=(const FramebufferSpec& other) const { return !(*this == other); }
+};
+
+// Offscreen render target with up to MAX_COLOR_ATTACHMENTS color attachments and an optional
+// depth-stencil one. Attachments are textures sampled with linear filtering and clamped edges, so
+// a later pass binds them like any Texture2D. They are never pooled into arrays: Renderer2D only
+// draws them in TextureMode::Slots.
+//
+// For per-frame intermediate targets use RenderTargetPool instead of creating framebuffers.
+class Framebuffer {
+public:
+    static constexpr uint32_t MAX_COLOR_ATTACHMENTS = 4;
+
+    virtual ~Framebuffer() = default;
+
+    // Draws go here from now on, with the viewport covering the whole framebuffer
+    virtual void Bind() = 0;
+    // Back to the default framebuffer; the caller restores its viewport
+    virtual void Unbind() = 0;
+
+    // Recreates the attachments at the new size. Attachment pointers taken before stay valid
+    // and keep the old image.
+    virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+    virtual const std::shared_ptr<Texture2D>& GetColorAttachment(uint32_t index = 0) const = 0;
+    // nullptr without a depth attachment
+    virtual const std::shared_ptr<Texture2D>& GetDepthAttachment() const = 0;
+
+    const FramebufferSpec& GetSpec() const { return m_Spec; }
+    uint32_t GetWidth() const { return m_Spec.Width; }
+    uint32_t GetHeight() const { return m_Spec.Height; }
+    // GPU memory of all attachments
+    uint64_t GetMemorySize() const;
+
+    // nullptr (and an error logged) for a zero size, too many attachments or a format in the
+    // wrong slot
+    static std::shared_ptr<Framebuffer> Create(const FramebufferSpec& spec);
+
+protected:
+    explicit Framebuffer(const FramebufferSpec& spec) : m_Spec(spec) {}
+
+    FramebufferSpec m_Spec;
+};
+
+}
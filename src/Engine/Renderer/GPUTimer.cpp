@@ -0,0 +1,18 @@
+#include "Engine/Renderer/GPUTimer.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Platform/OpenGL/OpenGLGPUTimer.h"
+#include "Platform/Capture/CaptureGPUTimer.h"
+
+namespace Engine {
+
+std::shared_ptr<GPUTimer> GPUTimer::Create(uint32_t framesInFlight) {
+    switch (RendererAPI::GetAPI()) {
+        case RendererAPI::API::None:    return nullptr;
+        case RendererAPI::API::OpenGL:
+            return OpenGLGPUTimer::IsSupported() ? std::make_shared<Engine::OpenGLGPUTimer>(framesInFlight) : nullptr;
+        case RendererAPI::API::Capture: return std::make_shared<Engine::CaptureGPUTimer>(framesInFlight);
+    }
+    return nullptr;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+// A finished GPU range. Times are ns on the Profiler::ClockNow() clock, so ranges line up with
+// CPU scopes in a trace.
+struct GPUTimerRange {
+    const char* Name;
+    uint64_t Start;
+    uint64_t End;
+    uint32_t Depth; // nesting level, 0 for a top-level range
+};
+
+// Asynchronous GPU timing with timestamp queries. Ranges are recorded into the current frame
+// and read back a few frames later, only once the GPU reports them available, so the CPU never
+// waits on a query. A frame whose slot comes around again before its results arrived is dropped.
+// Ranges nest; names must outlive the timer (string literals).
+class GPUTimer {
+public:
+    virtual ~GPUTimer() = default;
+
+    // Collects every finished frame and starts a new one. Returns true when GetResults() changed.
+    virtual bool BeginFrame() = 0;
+    // Returns the id to pass to EndRange
+    virtual uint32_t BeginRange(const char* name) = 0;
+    virtual void EndRange(uint32_t range) = 0;
+
+    // Ranges of the newest finished frame in BeginRange order, empty until one has finished
+    virtual const std::vector<GPUTimerRange>& GetResults() const = 0;
+    // Frames lost because their queries were still pending when the slot was reused
+    virtual uint32_t GetDroppedFrames() const = 0;
+
+    // nullptr when the device has no timer queries
+    static std::shared_ptr<GPUTimer> Create(uint32_t framesInFlight = 3);
+};
+
+}
@@ -0,0 +1,343 @@
+#include "Engine/Renderer/ParticleSystem.h"
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Core/SIMD.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <thread>
+
+namespace Engine {
+
+// Half the diagonal of a unit square: how far a rotated particle reaches past its center
+static constexpr float HALF_DIAGONAL = 0.7072f;
+
+// Per-channel blend of two RGBA8 colors, t in [0, 256]. Two channels per multiply, each
+// product stays within its 16 bits.
+static inline uint32_t LerpColor(uint32_t a, uint32_t b, uint32_t t) {
+    const uint32_t s = 256 - t;
+    const uint32_t rb = (((a & 0x00ff00ffu) * s + (b & 0x00ff00ffu) * t) >> 8) & 0x00ff00ffu;
+    const uint32_t ga = (((a >> 8) & 0x00ff00ffu) * s + ((b >> 8) & 0x00ff00ffu) * t) & 0xff00ff00u;
+    return rb | ga;
+}
+
+// sin and cos for quad corners, within 4e-5. The angle is reduced to [-pi, pi] by truncation
+// alone (a half turn flips both signs), then Taylor series to x^13 and x^14 take over. There are
+// no branches, so EmitQuads runs the same steps ENG_SIMD_WIDTH particles at a time.
+static constexpr float TWO_PI = 6.28318531f;
+static constexpr float SIN_TERMS[] = {1.0f / 6227020800.0f, -1.0f / 39916800.0f, 1.0f / 362880.0f,
+                                      -1.0f / 5040.0f, 1.0f / 120.0f, -1.0f / 6.0f, 1.0f};
+static constexpr float COS_TERMS[] = {-1.0f / 87178291200.0f, 1.0f / 479001600.0f, -1.0f / 3628800.0f,
+                                      1.0f / 40320.0f, -1.0f / 720.0f, 1.0f / 24.0f, -1.0f / 2.0f, 1.0f};
+
+static inline void SinCos(float angle, float& sin, float& cos) {
+    float turns = angle * (1.0f / TWO_PI);
+    turns -= static_cast<float>(static_cast<int32_t>(turns));                    // (-1, 1)
+    const float half = static_cast<float>(static_cast<int32_t>(turns * 2.0f)); // -1, 0 or 1
+    const float x = (turns - 0.5f * half) * TWO_PI;                               // [-pi, pi]
+    const float sign = 1.0f - 2.0f * half * half;
+
+    const float x2 = x * x;
+    sin = 0.0f;
+    for (float term : SIN_TERMS) sin = sin * x2 + term;
+    cos = 0.0f;
+    for (float term : COS_TERMS) cos = cos * x2 + term;
+    sin *= sign * x;
+    cos *= sign;
+}
+
+ParticleSystem::ParticleSystem(uint32_t capacity)
+    : m_Capacity(capacity), m_PositionX(capacity), m_PositionY(capacity), m_VelocityX(capacity),
+      m_VelocityY(capacity), m_Rotation(capacity), m_Spin(capacity), m_Age(capacity), m_InvLifeTime(capacity),
+      m_SizeBegin(capacity), m_SizeEnd(capacity), m_ColorBegin(capacity), m_ColorEnd(capacity),
+      m_ChunkResults((capacity + CHUNK_SIZE - 1) / CHUNK_SIZE), m_DeadIndices(capacity) {}
+
+ParticleSystem::EmitterID ParticleSystem::AddEmitter(const ParticleEmitter& emitter) {
+    m_Emitters.push_back(emitter);
+    m_EmitterDebt.push_back(0.0f);
+    return static_cast<EmitterID>(m_Emitters.size() - 1);
+}
+
+void ParticleSystem::Emit(const ParticleProps& props, uint32_t count) { Spawn(props, count); }
+
+void ParticleSystem::Clear() {
+    m_Count = 0;
+    m_BoundsMin = m_BoundsMax = Vec2(0.0f);
+    m_MaxSize = 0.0f;
+}
+
+float ParticleSystem::Random() {
+    // xorshift32, plenty for spawn jitter and far cheaper than <random>
+    m_Seed ^= m_Seed << 13;
+    m_Seed ^= m_Seed >> 17;
+    m_Seed ^= m_Seed << 5;
+    return static_cast<float>(m_Seed >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::Spawn(const ParticleProps& props, uint32_t count) {
+    const uint32_t spawned = std::min(count, m_Capacity - m_Count);
+    m_Dropped += count - spawned;
+    if (spawned == 0) return;
+
+    Vec2 min = m_Count > 0 ? m_BoundsMin : Vec2(FLT_MAX);
+    Vec2 max = m_Count > 0 ? m_BoundsMax : Vec2(-FLT_MAX);
+    const uint32_t colorBegin = Math::PackUnorm4x8(props.ColorBegin);
+    const uint32_t colorEnd = Math::PackUnorm4x8(props.ColorEnd);
+    for (uint32_t k = 0; k < spawned; k++) {
+        const uint32_t i = m_Count++;
+        const float x = props.Position.x + props.PositionVariation.x * (Random() - 0.5f);
+        const float y = props.Position.y + props.PositionVariation.y * (Random() - 0.5f);
+        m_PositionX[i] = x;
+        m_PositionY[i] = y;
+        m_VelocityX[i] = props.Velocity.x + props.VelocityVariation.x * (Random() - 0.5f);
+        m_VelocityY[i] = props.Velocity.y + props.VelocityVariation.y * (Random() - 0.5f);
+        m_Rotation[i] = props.Rotation + props.RotationVariation * (Random() - 0.5f);
+        m_Spin[i] = props.Spin + props.SpinVariation * (Random() - 0.5f);
+        m_Age[i] = 0.0f;
+        m_InvLifeTime[i] = 1.0f / std::max(props.LifeTime + props.LifeTimeVariation * (Random() - 0.5f), 1e-4f);
+
+        const float scale = 1.0f + props.SizeVariation * (Random() - 0.5f);
+        m_SizeBegin[i] = props.SizeBegin * scale;
+        m_SizeEnd[i] = props.SizeEnd * scale;
+        m_ColorBegin[i] = colorBegin;
+        m_ColorEnd[i] = colorEnd;
+
+        const float size = std::max(m_SizeBegin[i], m_SizeEnd[i]);
+        m_MaxSize = std::max(m_MaxSize, size);
+        min = glm::min(min, Vec2(x - size * HALF_DIAGONAL, y - size * HALF_DIAGONAL));
+        max = glm::max(max, Vec2(x + size * HALF_DIAGONAL, y + size * HALF_DIAGONAL));
+    }
+    m_BoundsMin = min;
+    m_BoundsMax = max;
+}
+
+ParticleSystem::ChunkResult ParticleSystem::Integrate(uint32_t first, uint32_t last, float dt) {
+    float* posX = m_PositionX.data();
+    float* posY = m_PositionY.data();
+    float* velX = m_VelocityX.data();
+    float* velY = m_VelocityY.data();
+    float* rotation = m_Rotation.data();
+    const float* spin = m_Spin.data();
+    float* age = m_Age.data();
+    const float* invLifeTime = m_InvLifeTime.data();
+    uint32_t* dead = m_DeadIndices.data() + first;
+    const float gx = m_Gravity.x * dt, gy = m_Gravity.y * dt;
+
+    ChunkResult result = {Vec2(FLT_MAX), Vec2(-FLT_MAX), 0};
+    uint32_t i = first;
+
+#if ENG_SIMD_WIDTH > 1
+    using namespace SIMD;
+    const Lane step = Splat(dt), gravityX = Splat(gx), gravityY = Splat(gy), one = Splat(1.0f);
+    const int allAlive = (1 << LANES) - 1;
+    Lane minX = Splat(FLT_MAX), minY = minX, maxX = Splat(-FLT_MAX), maxY = maxX;
+    for (; i + LANES <= last; i += LANES) {
+        // Semi-implicit Euler: velocity first, then position with the new velocity
+        const Lane vx = Add(Load(velX + i), gravityX);
+        const Lane vy = Add(Load(velY + i), gravityY);
+        const Lane x = Add(Load(posX + i), Mul(vx, step));
+        const Lane y = Add(Load(posY + i), Mul(vy, step));
+        Store(velX + i, vx);
+        Store(velY + i, vy);
+        Store(posX + i, x);
+        Store(posY + i, y);
+        Store(rotation + i, Add(Load(rotation + i), Mul(Load(spin + i), step)));
+
+        const Lane a = Add(Load(age + i), step);
+        Store(age + i, a);
+        const int alive = Mask(Less(Mul(a, Load(invLifeTime + i)), one));
+        if (alive != allAlive) {
+            for (uint32_t l = 0; l < LANES; l++) {
+                if (!(alive & (1 << l))) dead[result.Dead++] = i + l;
+            }
+        }
+
+        minX = Min(minX, x);
+        minY = Min(minY, y);
+        maxX = Max(maxX, x);
+        maxY = Max(maxY, y);
+    }
+
+    alignas(32) float lanes[4][LANES];
+    Store(lanes[0], minX);
+    Store(lanes[1], minY);
+    Store(lanes[2], maxX);
+    Store(lanes[3], maxY);
+    for (size_t l = 0; l < LANES; l++) {
+        result.Min = glm::min(result.Min, Vec2(lanes[0][l], lanes[1][l]));
+        result.Max = glm::max(result.Max, Vec2(lanes[2][l], lanes[3][l]));
+    }
+#endif
+
+    // Scalar tail (or the whole chunk on builds without SIMD)
+    for (; i < last; i++) {
+        velX[i] += gx;
+        velY[i] += gy;
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        rotation[i] += spin[i] * dt;
+        age[i] += dt;
+        if (age[i] * invLifeTime[i] >= 1.0f) dead[result.Dead++] = i;
+        result.Min = glm::min(result.Min, Vec2(posX[i], posY[i]));
+        result.Max = glm::max(result.Max, Vec2(posX[i], posY[i]));
+    }
+    return result;
+}
+
+void ParticleSystem::RemoveDead(uint32_t chunkCount) {
+    // Highest index first: every slot above the one being filled is already alive, so the
+    // particle moved in from the end never needs a second look
+    for (uint32_t c = chunkCount; c-- > 0;) {
+        const uint32_t* dead = m_DeadIndices.data() + c * CHUNK_SIZE;
+        for (uint32_t d = m_ChunkResults[c].Dead; d-- > 0;) {
+            const uint32_t i = dead[d];
+            const uint32_t last = --m_Count;
+            if (i == last) continue;
+            m_PositionX[i] = m_PositionX[last];
+            m_PositionY[i] = m_PositionY[last];
+            m_VelocityX[i] = m_VelocityX[last];
+            m_VelocityY[i] = m_VelocityY[last];
+            m_Rotation[i] = m_Rotation[last];
+            m_Spin[i] = m_Spin[last];
+            m_Age[i] = m_Age[last];
+            m_InvLifeTime[i] = m_InvLifeTime[last];
+            m_SizeBegin[i] = m_SizeBegin[last];
+            m_SizeEnd[i] = m_SizeEnd[last];
+            m_ColorBegin[i] = m_ColorBegin[last];
+            m_ColorEnd[i] = m_ColorEnd[last];
+        }
+    }
+}
+
+void ParticleSystem::Update(Timestep ts) {
+    const float dt = ts.GetSeconds();
+
+    if (m_Count > 0) {
+        // Chunks are disjoint, so workers integrate them without synchronization
+        const uint32_t count = m_Count;
+        const uint32_t chunks = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        std::atomic<uint32_t> next{0};
+        auto work = [&]() {
+            for (uint32_t c = next++; c < chunks; c = next++) {
+                m_ChunkResults[c] = Integrate(c * CHUNK_SIZE, std::min(count, (c + 1) * CHUNK_SIZE), dt);
+            }
+        };
+        const uint32_t workerCount = std::min(m_WorkerCount, chunks);
+        std::vector<std::thread> workers;
+        for (uint32_t w = 1; w < workerCount; w++) workers.emplace_back(work);
+        work();
+        for (std::thread& worker : workers) worker.join();
+
+        Vec2 min(FLT_MAX), max(-FLT_MAX);
+        uint32_t dead = 0;
+        for (uint32_t c = 0; c < chunks; c++) {
+            const ChunkResult& result = m_ChunkResults[c];
+            min = glm::min(min, result.Min);
+            max = glm::max(max, result.Max);
+            dead += result.Dead;
+        }
+        // Still covers the expired particles, which only makes the bounds looser
+        m_BoundsMin = min - Vec2(m_MaxSize * HALF_DIAGONAL);
+        m_BoundsMax = max + Vec2(m_MaxSize * HALF_DIAGONAL);
+        if (dead > 0) RemoveDead(chunks);
+    }
+    if (m_Count == 0) Clear();
+
+    for (size_t e = 0; e < m_Emitters.size(); e++) {
+        const ParticleEmitter& emitter = m_Emitters[e];
+        if (!emitter.Enabled) continue;
+        float& debt = m_EmitterDebt[e];
+        debt += emitter.Rate * dt;
+        const uint32_t count = static_cast<uint32_t>(debt);
+        debt -= static_cast<float>(count);
+        Spawn(emitter.Props, count);
+    }
+}
+
+void ParticleSystem::EmitQuads(size_t first, size_t count, float texIndex, QuadVertex* out) const {
+    const uint16_t tiling = Math::PackHalf(1.0f);
+    const uint16_t index = static_cast<uint16_t>(texIndex);
+    constexpr size_t BLOCK = 256;
+    alignas(32) float axisX[BLOCK];
+    alignas(32) float axisY[BLOCK];
+    alignas(32) int32_t fractions[BLOCK];
+
+    for (size_t block = first; block < first + count; block += BLOCK) {
+        const size_t n = std::min(BLOCK, first + count - block);
+
+        // Half-axis (cos, sin) * size / 2 and lifetime fraction per particle, the part worth
+        // vectorizing: Math::Sin/Cos alone would cost more than writing the quad
+        size_t k = 0;
+#if ENG_SIMD_WIDTH > 1
+        using namespace SIMD;
+        const Lane one = Splat(1.0f), two = Splat(2.0f), pointFive = Splat(0.5f), twoPi = Splat(TWO_PI);
+        for (; k + LANES <= n; k += LANES) {
+            const size_t i = block + k;
+            const Lane t = Min(Mul(Load(&m_Age[i]), Load(&m_InvLifeTime[i])), one);
+            const Lane sizeBegin = Load(&m_SizeBegin[i]);
+            const Lane half = Mul(Add(sizeBegin, Mul(Sub(Load(&m_SizeEnd[i]), sizeBegin), t)), pointFive);
+            StoreInt(&fractions[k], Mul(t, Splat(256.0f)));
+
+            Lane turns = Mul(Load(&m_Rotation[i]), Splat(1.0f / TWO_PI));
+            turns = Sub(turns, Truncate(turns));
+            const Lane halfTurn = Truncate(Mul(turns, two));
+            const Lane x = Mul(Sub(turns, Mul(pointFive, halfTurn)), twoPi);
+            const Lane sign = Sub(one, Mul(two, Mul(halfTurn, halfTurn)));
+            const Lane x2 = Mul(x, x);
+            Lane sin = Splat(0.0f), cos = Splat(0.0f);
+            for (float term : SIN_TERMS) sin = Add(Mul(sin, x2), Splat(term));
+            for (float term : COS_TERMS) cos = Add(Mul(cos, x2), Splat(term));
+            Store(&axisX[k], Mul(Mul(cos, sign), half));
+            Store(&axisY[k], Mul(Mul(Mul(sin, x), sign), half));
+        }
+#endif
+        // Scalar tail (or the whole block on builds without SIMD)
+        for (; k < n; k++) {
+            const size_t i = block + k;
+            const float t = std::min(m_Age[i] * m_InvLifeTime[i], 1.0f);
+            const float half = (m_SizeBegin[i] + (m_SizeEnd[i] - m_SizeBegin[i]) * t) * 0.5f;
+            fractions[k] = static_cast<int32_t>(t * 256.0f);
+            float sin, cos;
+            SinCos(m_Rotation[i], sin, cos);
+            axisX[k] = cos * half;
+            axisY[k] = sin * half;
+        }
+
+        // Corners as in QuadKernels::EmitQuad: a = (ax, ay), b = (-ay, ax)
+        for (size_t k = 0; k < n; k++) {
+            const float x = m_PositionX[block + k], y = m_PositionY[block + k];
+            const float ax = axisX[k], ay = axisY[k];
+            const uint32_t color = LerpColor(m_ColorBegin[block + k], m_ColorEnd[block + k], fractions[k]);
+            const float cornerX[4] = {x - ax + ay, x + ax + ay, x + ax - ay, x - ax - ay};
+            const float cornerY[4] = {y - ay - ax, y + ay - ax, y + ay + ax, y - ay + ax};
+            for (size_t v = 0; v < 4; v++) {
+                out->Position = {cornerX[v], cornerY[v], m_Depth};
+                out->Color = color;
+                out->TexCoord = QuadKernels::DefaultTexCoordsPacked[v];
+                out->TilingFactor = tiling;
+                out->TexIndex = index;
+                out++;
+            }
+        }
+    }
+}
+
+void ParticleSystem::EmitInstances(size_t first, size_t count, float texIndex, QuadInstance* out) const {
+    const uint16_t tiling = Math::PackHalf(1.0f);
+    const uint16_t index = static_cast<uint16_t>(texIndex);
+    for (size_t i = first; i < first + count; i++) {
+        const float t = std::min(m_Age[i] * m_InvLifeTime[i], 1.0f);
+        const float size = m_SizeBegin[i] + (m_SizeEnd[i] - m_SizeBegin[i]) * t;
+        out->Position = {m_PositionX[i], m_PositionY[i], m_Depth};
+        out->Size = {size, size};
+        out->Rotation = m_Rotation[i];
+        out->Color = LerpColor(m_ColorBegin[i], m_ColorEnd[i], static_cast<uint32_t>(t * 256.0f));
+        out->TexRectMin = QuadKernels::DefaultTexCoordsPacked[0];
+        out->TexRectMax = QuadKernels::DefaultTexCoordsPacked[2];
+        out->TilingFactor = tiling;
+        out->TexIndex = index;
+        out++;
+    }
+}
+
+}
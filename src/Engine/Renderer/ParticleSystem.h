@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+#include "Engine/Core/Timestep.h"
+#include "Engine/Renderer/TextureRegistry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+struct QuadInstance;
+struct QuadVertex;
+
+// Spawn parameters. Each Variation is the full width of a uniform range centered on its value.
+struct ParticleProps {
+    Vec2 Position = Vec2(0.0f);
+    Vec2 PositionVariation = Vec2(0.0f);
+    Vec2 Velocity = Vec2(0.0f);
+    Vec2 VelocityVariation = Vec2(1.0f);
+    Vec4 ColorBegin = Vec4(1.0f);
+    Vec4 ColorEnd = Vec4(1.0f, 1.0f, 1.0f, 0.0f);
+    float SizeBegin = 0.1f;
+    float SizeEnd = 0.0f;
+    float SizeVariation = 0.0f; // scales both ends by the same factor
+    float Rotation = 0.0f;      // radians
+    float RotationVariation = 0.0f;
+    float Spin = 0.0f;          // radians per second
+    float SpinVariation = 0.0f;
+    float LifeTime = 1.0f;      // seconds
+    float LifeTimeVariation = 0.0f;
+};
+
+// Continuous source, spawns Rate particles per second while enabled. Move it by editing
+// Props.Position between updates.
+struct ParticleEmitter {
+    ParticleProps Props;
+    float Rate = 100.0f;
+    bool Enabled = true;
+};
+
+// Fixed-capacity particle pool drawn with Renderer2D::DrawParticles. Particles are square, live
+// structure-of-arrays and are integrated ENG_SIMD_WIDTH at a time, optionally split across
+// worker threads. Dead particles are swap-removed, so nothing is allocated after construction
+// and spawns beyond the capacity are dropped. Color and size are interpolated over the lifetime
+// while the quads are written, straight into the renderer's vertex or instance buffer.
+class ParticleSystem {
+public:
+    using EmitterID = uint32_t;
+
+    explicit ParticleSystem(uint32_t capacity = 100000);
+
+    // Spawns `count` particles now
+    void Emit(const ParticleProps& props, uint32_t count = 1);
+
+    // IDs are stable; disable an emitter instead of removing it
+    EmitterID AddEmitter(const ParticleEmitter& emitter);
+    ParticleEmitter& GetEmitter(EmitterID id) { return m_Emitters[id]; }
+
+    // Constant acceleration applied to every particle
+    void SetGravity(const Vec2& gravity) { m_Gravity = gravity; }
+    // All particles draw at this z
+    void SetDepth(float z) { m_Depth = z; }
+    // Invalid draws untextured
+    void SetTexture(TextureHandle texture) { m_Texture = texture; }
+    // Threads Update integrates on, the calling one included. Only worth it for large pools.
+    void SetWorkerCount(uint32_t count) { m_WorkerCount = count < 1 ? 1 : count; }
+
+    // Integrates, removes expired particles, then spawns from the emitters
+    void Update(Timestep ts);
+    // Drops every live particle, keeps the emitters
+    void Clear();
+
+    uint32_t GetCount() const { return m_Count; }
+    uint32_t GetCapacity() const { return m_Capacity; }
+    // Spawns dropped because the pool was full, since construction
+    uint64_t GetDroppedCount() const { return m_Dropped; }
+    TextureHandle GetTexture() const { return m_Texture; }
+    // Conservative bounds of the live particles' quads, as of the last Update or Emit
+    const Vec2& GetBoundsMin() const { return m_BoundsMin; }
+    const Vec2& GetBoundsMax() const { return m_BoundsMax; }
+
+private:
+    friend class Renderer2D;
+
+    static constexpr uint32_t CHUNK_SIZE = 16384; // particles per work item in Update
+
+    struct ChunkResult {
+        Vec2 Min;
+        Vec2 Max;
+        uint32_t Dead;
+    };
+
+    // Integrates particles [first, last), reports their position bounds and writes the indices
+    // that expired to m_DeadIndices from `first` on
+    ChunkResult Integrate(uint32_t first, uint32_t last, float dt);
+    void RemoveDead(uint32_t chunkCount);
+    void Spawn(const ParticleProps& props, uint32_t count);
+    float Random(); // [0, 1)
+
+    // Write particles [first, first + count) as quads for the renderer
+    void EmitQuads(size_t first, size_t count, float texIndex, QuadVertex* out) const;
+    void EmitInstances(size_t first, size_t count, float texIndex, QuadInstance* out) const;
+
+    uint32_t m_Capacity;
+    uint32_t m_Count = 0;
+    uint64_t m_Dropped = 0;
+
+    // One entry per particle slot, the first m_Count are alive
+    std::vector<float> m_PositionX;
+    std::vector<float> m_PositionY;
+    std::vector<float> m_VelocityX;
+    std::vector<float> m_VelocityY;
+    std::vector<float> m_Rotation;
+    std::vector<float> m_Spin;
+    std::vector<float> m_Age;
+    std::vector<float> m_InvLifeTime;
+    std::vector<float> m_SizeBegin;
+    std::vector<float> m_SizeEnd;
+    std::vector<uint32_t> m_ColorBegin; // RGBA8
+    std::vector<uint32_t> m_ColorEnd;
+
+    std::vector<ParticleEmitter> m_Emitters;
+    std::vector<float> m_EmitterDebt; // fractional particles carried to the next Update
+    std::vector<ChunkResult> m_ChunkResults;
+    std::vector<uint32_t> m_DeadIndices; // per chunk, ascending, only the first ChunkResult::Dead are set
+
+    Vec2 m_Gravity = Vec2(0.0f);
+    float m_Depth = 0.0f;
+    TextureHandle m_Texture;
+    uint32_t m_WorkerCount = 1;
+    uint32_t m_Seed = 0x9E3779B9u;
+
+    Vec2 m_BoundsMin = Vec2(0.0f);
+    Vec2 m_BoundsMax = Vec2(0.0f);
+    float m_MaxSize = 0.0f; // largest size any live particle can reach, pads the bounds
+};
+
+}
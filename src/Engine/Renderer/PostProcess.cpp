@@ -0,0 +1,234 @@
+#include "Engine/Renderer/PostProcess.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+#include "Engine/Renderer/GPUTimer.h"
+#include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/RenderTargetPool.h"
+#include "Engine/Renderer/Shader.h"
+#include "Engine/Renderer/VertexArray.h"
+
+#include <algorithm>
+#include <array>
+
+namespace Engine {
+
+static const uint32_t MAX_BLOOM_MIPS = 12;
+static const uint32_t MIN_BLOOM_MIP_SIZE = 8; // px, smaller mips only add blur nobody sees
+// Bloom needs no alpha, and the packed float format halves the chain's bandwidth
+static const RenderTargetFormat BLOOM_FORMAT = RenderTargetFormat::R11G11B10F;
+
+// GPU ranges; stats are matched by pointer, the timer keeps the names as given
+static const char* const RANGE_FRAME = "PostProcess";
+static const char* const RANGE_DOWNSAMPLE = "PostProcess::Downsample";
+static const char* const RANGE_UPSAMPLE = "PostProcess::Upsample";
+static const char* const RANGE_COMPOSITE = "PostProcess::Composite";
+
+struct PostProcessData {
+    PostProcessSettings Settings;
+    PostProcessStats Stats;
+    PostProcessStats GPUStats; // of the newest finished frame, copied into Stats each frame
+
+    // No buffers, fullscreen.vert builds the triangle from gl_VertexID
+    std::shared_ptr<VertexArray> FullscreenTriangle;
+    std::shared_ptr<Shader> DownsampleShader;
+    std::shared_ptr<Shader> UpsampleShader;
+    std::shared_ptr<Shader> CompositeShader;
+
+    // Between BeginFrame and EndFrame
+    std::shared_ptr<Framebuffer> Scene;
+    // Bloom mip 0 after the upsample, read by the composite
+    std::shared_ptr<Framebuffer> BloomResult;
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+
+    std::shared_ptr<GPUTimer> Timer;
+};
+
+static PostProcessData s_Data;
+
+static void DrawFullscreen() { RenderCommand::DrawArraysInstanced(s_Data.FullscreenTriangle, 3, 1); }
+
+void PostProcess::Init() {
+    ENG_PROFILE_FUNCTION();
+
+    s_Data.FullscreenTriangle = VertexArray::Create();
+    s_Data.DownsampleShader = Shader::Create("assets/engine/shaders/fullscreen.vert",
+                                             "assets/engine/shaders/post_downsample.frag");
+    s_Data.UpsampleShader = Shader::Create("assets/engine/shaders/fullscreen.vert",
+                                           "assets/engine/shaders/post_upsample.frag");
+    s_Data.CompositeShader = Shader::Create("assets/engine/shaders/fullscreen.vert",
+                                            "assets/engine/shaders/post_composite.frag");
+
+    s_Data.Timer = GPUTimer::Create();
+    s_Data.Stats = {};
+    s_Data.GPUStats = {};
+}
+
+void PostProcess::Shutdown() {
+    s_Data.FullscreenTriangle.reset();
+    s_Data.DownsampleShader.reset();
+    s_Data.UpsampleShader.reset();
+    s_Data.CompositeShader.reset();
+    s_Data.Scene.reset();
+    s_Data.BloomResult.reset();
+    s_Data.Timer.reset();
+}
+
+void PostProcess::BeginFrame(uint32_t width, uint32_t height) {
+    s_Data.Width = width;
+    s_Data.Height = height;
+    if (!s_Data.Settings.Enabled || !s_Data.CompositeShader) return;
+
+    FramebufferSpec spec;
+    spec.Width = width;
+    spec.Height = height;
+    spec.ColorAttachments = {s_Data.Settings.SceneFormat};
+    spec.DepthAttachment = RenderTargetFormat::Depth24Stencil8;
+    s_Data.Scene = RenderTargetPool::Acquire(spec);
+    if (s_Data.Scene) s_Data.Scene->Bind();
+}
+
+void PostProcess::EndFrame() {
+    if (!s_Data.Scene) return;
+    ENG_PROFILE_FUNCTION();
+
+    // Dropped on return, so the pool can hand the target out again next frame
+    std::shared_ptr<Framebuffer> scene = std::move(s_Data.Scene);
+
+    uint32_t frameRange = 0;
+    if (s_Data.Timer) {
+        if (s_Data.Timer->BeginFrame()) CollectGPUTimings();
+        frameRange = s_Data.Timer->BeginRange(RANGE_FRAME);
+    }
+    s_Data.Stats = s_Data.GPUStats;
+    s_Data.Stats.BloomMips = 0;
+
+    // Every pass covers its whole target and writes it once
+    RenderCommand::SetDepthTest(false);
+    RenderCommand::SetBlendFunc(BlendFunc::None);
+
+    if (s_Data.Settings.Bloom) Bloom(*scene);
+    Composite(*scene);
+    s_Data.BloomResult.reset();
+
+    RenderCommand::SetBlendFunc(BlendFunc::Alpha);
+    RenderCommand::SetDepthTest(true);
+
+    if (s_Data.Timer) s_Data.Timer->EndRange(frameRange);
+}
+
+void PostProcess::Bloom(const Framebuffer& scene) {
+    ENG_PROFILE_FUNCTION();
+    const PostProcessSettings& settings = s_Data.Settings;
+
+    std::array<std::shared_ptr<Framebuffer>, MAX_BLOOM_MIPS> mips;
+    const uint32_t maxMips = std::min(settings.BloomMips, MAX_BLOOM_MIPS);
+    uint32_t mipCount = 0;
+    uint32_t width = scene.GetWidth() / 2;
+    uint32_t height = scene.GetHeight() / 2;
+    while (mipCount < maxMips && std::min(width, height) >= MIN_BLOOM_MIP_SIZE) {
+        FramebufferSpec spec;
+        spec.Width = width;
+        spec.Height = height;
+        spec.ColorAttachments = {BLOOM_FORMAT};
+        mips[mipCount++] = RenderTargetPool::Acquire(spec);
+        width /= 2;
+        height /= 2;
+    }
+    s_Data.Stats.BloomMips = mipCount;
+    if (mipCount == 0) return;
+
+    // Downsample: the scene into mip 0 through the threshold, then each mip into the next
+    {
+        ENG_PROFILE_SCOPE("PostProcess::Downsample");
+        uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange(RANGE_DOWNSAMPLE) : 0;
+
+        // Quadratic soft knee below the threshold, see post_downsample.frag
+        const float knee = std::max(settings.BloomKnee, 1e-4f);
+        Shader& shader = *s_Data.DownsampleShader;
+        shader.Bind();
+        shader.SetInt("u_Source", 0);
+        shader.SetFloat4("u_Threshold", {settings.BloomThreshold, settings.BloomThreshold - knee, 2.0f * knee,
+                                         0.25f / knee});
+
+        const Texture2D* source = scene.GetColorAttachment().get();
+        for (uint32_t i = 0; i < mipCount; i++) {
+            mips[i]->Bind();
+            shader.SetInt("u_Prefilter", i == 0);
+            source->Bind(0);
+            DrawFullscreen();
+            source = mips[i]->GetColorAttachment().get();
+        }
+
+        if (s_Data.Timer) s_Data.Timer->EndRange(range);
+    }
+
+    // Upsample: each mip blurred with a tent and added onto the next larger one, in place
+    {
+        ENG_PROFILE_SCOPE("PostProcess::Upsample");
+        uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange(RANGE_UPSAMPLE) : 0;
+
+        Shader& shader = *s_Data.UpsampleShader;
+        shader.Bind();
+        shader.SetInt("u_Source", 0);
+        shader.SetFloat("u_Radius", settings.BloomRadius);
+
+        RenderCommand::SetBlendFunc(BlendFunc::Additive);
+        for (uint32_t i = mipCount - 1; i > 0; i--) {
+            mips[i - 1]->Bind();
+            mips[i]->GetColorAttachment()->Bind(0);
+            DrawFullscreen();
+        }
+        RenderCommand::SetBlendFunc(BlendFunc::None);
+
+        if (s_Data.Timer) s_Data.Timer->EndRange(range);
+    }
+
+    s_Data.BloomResult = mips[0];
+}
+
+void PostProcess::Composite(Framebuffer& scene) {
+    ENG_PROFILE_FUNCTION();
+    uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange(RANGE_COMPOSITE) : 0;
+    const PostProcessSettings& settings = s_Data.Settings;
+
+    scene.Unbind();
+    RenderCommand::SetViewport(0, 0, s_Data.Width, s_Data.Height);
+
+    scene.GetColorAttachment()->Bind(0);
+    // Without bloom the scene stands in at unit 1 and contributes nothing
+    const bool bloom = s_Data.BloomResult != nullptr;
+    (bloom ? s_Data.BloomResult->GetColorAttachment() : scene.GetColorAttachment())->Bind(1);
+
+    Shader& shader = *s_Data.CompositeShader;
+    shader.Bind();
+    shader.SetInt("u_Scene", 0);
+    shader.SetInt("u_Bloom", 1);
+    shader.SetFloat("u_BloomIntensity", bloom ? settings.BloomIntensity : 0.0f);
+    shader.SetFloat("u_BloomRadius", settings.BloomRadius);
+    shader.SetFloat("u_Exposure", settings.Exposure);
+    shader.SetInt("u_ToneMapper", static_cast<int>(settings.ToneMapping ? settings.Mapper : ToneMapper::None));
+    DrawFullscreen();
+
+    if (s_Data.Timer) s_Data.Timer->EndRange(range);
+}
+
+void PostProcess::CollectGPUTimings() {
+    PostProcessStats& gpu = s_Data.GPUStats;
+    gpu = {};
+    const bool trace = Profiler::IsActive();
+    for (const GPUTimerRange& range : s_Data.Timer->GetResults()) {
+        float time = (range.End - range.Start) / 1e6f;
+        if (range.Name == RANGE_FRAME) gpu.GPUTotalTime += time;
+        else if (range.Name == RANGE_DOWNSAMPLE) gpu.GPUDownsampleTime += time;
+        else if (range.Name == RANGE_UPSAMPLE) gpu.GPUUpsampleTime += time;
+        else if (range.Name == RANGE_COMPOSITE) gpu.GPUCompositeTime += time;
+        if (trace) Profiler::RecordGPU(range.Name, range.Start, range.End);
+    }
+}
+
+PostProcessSettings& PostProcess::GetSettings() { return s_Data.Settings; }
+
+const PostProcessStats& PostProcess::GetStats() { return s_Data.Stats; }
+
+}
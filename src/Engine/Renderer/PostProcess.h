@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+
+#include <cstdint>
+
+namespace Engine {
+
+enum class ToneMapper {
+    None = 0, // clamps, the scene looks as it would without the HDR target
+    Reinhard,
+    ACES      // Narkowicz's fit of the ACES filmic curve
+};
+
+struct PostProcessSettings {
+    bool Enabled = true; // off: layers draw straight to the window
+
+    bool Bloom = true;
+    // Brightness where bloom starts. Renderer2D colors are RGBA8 and never exceed 1, so the
+    // default catches the brightest LDR colors; raise it above 1 for HDR content.
+    float BloomThreshold = 0.8f;
+    float BloomKnee = 0.3f;      // width of the soft transition below the threshold
+    float BloomIntensity = 0.5f;
+    float BloomRadius = 1.0f;    // tent filter scale of the upsample, in source texels
+    uint32_t BloomMips = 6;      // at most; the chain stops before a mip gets smaller than 8 px
+
+    bool ToneMapping = true;
+    ToneMapper Mapper = ToneMapper::ACES;
+    float Exposure = 1.0f;
+
+    RenderTargetFormat SceneFormat = RenderTargetFormat::RGBA16F;
+};
+
+// GPU times of the newest frame the GPU has finished, a few frames old, in ms. All zero
+// without timer queries.
+struct PostProcessStats {
+    float GPUDownsampleTime = 0.0f; // prefilter included
+    float GPUUpsampleTime = 0.0f;
+    float GPUCompositeTime = 0.0f;
+    float GPUTotalTime = 0.0f;
+    uint32_t BloomMips = 0;         // of the last frame
+};
+
+// HDR post-processing of the whole frame. BeginFrame redirects drawing into a scene target of
+// SceneFormat, so layers render and clear as before, only with values above 1 kept.
+// EndFrame then runs bloom and tone mapping into the window.
+//
+// Bloom is a progressive mip chain, not a full-resolution blur. The scene is prefiltered into a
+// half-size mip, which is downsampled with a 13-tap filter while each mip halves. Then every
+// mip is upsampled with a 3x3 tent and added onto the next larger one. Each pass reads at most
+// a quarter of the pixels of the one before, so the whole chain costs about two full-resolution
+// passes whatever the blur radius. All targets come from the RenderTargetPool.
+//
+// Application::Run calls BeginFrame and EndFrame around the layers.
+class PostProcess {
+public:
+    static void Init();
+    static void Shutdown();
+
+    static void BeginFrame(uint32_t width, uint32_t height);
+    // Leaves the default framebuffer bound with the window's viewport
+    static void EndFrame();
+
+    static PostProcessSettings& GetSettings();
+    static const PostProcessStats& GetStats();
+
+private:
+    static void Bloom(const Framebuffer& scene);
+    static void Composite(Framebuffer& scene);
+    static void CollectGPUTimings();
+};
+
+}
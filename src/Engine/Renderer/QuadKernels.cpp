@@ -0,0 +1,137 @@
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Core/SIMD.h"
+
+namespace Engine {
+namespace QuadKernels {
+
+const Vec2 DefaultTexCoords[4] = {
+    {0.0f, 0.0f},
+    {1.0f, 0.0f},
+    {1.0f, 1.0f},
+    {0.0f, 1.0f},
+};
+
+const uint32_t DefaultTexCoordsPacked[4] = {
+    0x00000000u,
+    0x0000ffffu,
+    0xffffffffu,
+    0xffff0000u,
+};
+
+static inline void QuadTexCoords(const QuadKernelInput& input, size_t q, uint32_t* uv) {
+    if (input.Frames) {
+        PackRectTexCoords(input.FrameRects + input.Frames[q] * 2, uv);
+    } else {
+        PackTexCoords(input.TexCoords ? input.TexCoords + q * 4 : DefaultTexCoords, uv);
+    }
+}
+
+void EmitQuads(const QuadKernelInput& input, size_t first, size_t count, QuadVertex* out) {
+    auto source = [&input](size_t n) -> size_t { return input.Indices ? input.Indices[n] : n; };
+    size_t i = 0;
+
+#if ENG_SIMD_WIDTH > 1
+    using namespace SIMD;
+    // Uniform values are packed once per call, not per quad
+    const uint32_t uniformColor = Math::PackUnorm4x8(input.Color);
+    const uint16_t tiling = Math::PackHalf(input.TilingFactor);
+    alignas(32) float px[LANES], py[LANES], hx[LANES], hy[LANES], cosR[LANES], sinR[LANES];
+    alignas(32) float cornerX[4][LANES], cornerY[4][LANES];
+    size_t quad[LANES];
+
+    for (; i + LANES <= count; i += LANES) {
+        bool rotated = false;
+        for (size_t l = 0; l < LANES; l++) {
+            const size_t q = quad[l] = source(first + i + l);
+            const Vec3& position = input.Positions[q];
+            const Vec2& size = input.Sizes[q];
+            px[l] = position.x;
+            py[l] = position.y;
+            hx[l] = size.x * 0.5f;
+            hy[l] = size.y * 0.5f;
+            sinR[l] = input.Rotations ? input.Rotations[q] : 0.0f;
+            rotated |= sinR[l] != 0.0f;
+        }
+
+        Lane vpx = Load(px), vpy = Load(py);
+        Lane vhx = Load(hx), vhy = Load(hy);
+
+        if (!rotated) {
+            // Axis-aligned fast path: corners are just min/max of the rect
+            Lane left = Sub(vpx, vhx), right = Add(vpx, vhx);
+            Lane bottom = Sub(vpy, vhy), top = Add(vpy, vhy);
+            Store(cornerX[0], left);  Store(cornerY[0], bottom);
+            Store(cornerX[1], right); Store(cornerY[1], bottom);
+            Store(cornerX[2], right); Store(cornerY[2], top);
+            Store(cornerX[3], left);  Store(cornerY[3], top);
+        } else {
+            for (size_t l = 0; l < LANES; l++) {
+                float rotation = sinR[l];
+                cosR[l] = Math::Cos(rotation);
+                sinR[l] = Math::Sin(rotation);
+            }
+            Lane vc = Load(cosR), vs = Load(sinR);
+
+            // a = R * (hx, 0), b = R * (0, hy)
+            Lane ax = Mul(vc, vhx), ay = Mul(vs, vhx);
+            Lane bx = Mul(vs, vhy), by = Mul(vc, vhy); // bx is negated below
+
+            Lane sumX = Sub(ax, bx), sumY = Add(ay, by);  // a + b
+            Lane diffX = Add(ax, bx), diffY = Sub(ay, by); // a - b
+            Store(cornerX[0], Sub(vpx, sumX));  Store(cornerY[0], Sub(vpy, sumY));
+            Store(cornerX[1], Add(vpx, diffX)); Store(cornerY[1], Add(vpy, diffY));
+            Store(cornerX[2], Add(vpx, sumX));  Store(cornerY[2], Add(vpy, sumY));
+            Store(cornerX[3], Sub(vpx, diffX)); Store(cornerY[3], Sub(vpy, diffY));
+        }
+
+        QuadVertex* dst = out + i * 4;
+        for (size_t l = 0; l < LANES; l++) {
+            const size_t q = quad[l];
+            const float z = input.Positions[q].z;
+            const uint32_t color = input.Colors ? Math::PackUnorm4x8(input.Colors[q]) : uniformColor;
+            const uint16_t texIndex =
+                static_cast<uint16_t>(input.TexIndices ? input.TexIndices[q] : input.TexIndex);
+            uint32_t uv[4];
+            QuadTexCoords(input, q, uv);
+            for (size_t k = 0; k < 4; k++) {
+                dst->Position = {cornerX[k][l], cornerY[k][l], z};
+                dst->Color = color;
+                dst->TexCoord = uv[k];
+                dst->TilingFactor = tiling;
+                dst->TexIndex = texIndex;
+                dst++;
+            }
+        }
+    }
+#endif
+
+    // Scalar tail (or the whole range on builds without SIMD)
+    for (; i < count; i++) {
+        const size_t q = source(first + i);
+        uint32_t uv[4];
+        QuadTexCoords(input, q, uv);
+        EmitQuad(out + i * 4, input.Positions[q], input.Sizes[q], input.Rotations ? input.Rotations[q] : 0.0f,
+                 input.Colors ? input.Colors[q] : input.Color,
+                 input.TexIndices ? input.TexIndices[q] : input.TexIndex, input.TilingFactor, uv);
+    }
+}
+
+void EmitInstances(const QuadKernelInput& input, size_t first, size_t count, QuadInstance* out) {
+    for (size_t i = 0; i < count; i++) {
+        const size_t q = input.Indices ? input.Indices[first + i] : first + i;
+        EmitInstance(out + i, input.Positions[q], input.Sizes[q], input.Rotations ? input.Rotations[q] : 0.0f,
+                     input.Colors ? input.Colors[q] : input.Color,
+                     input.TexIndices ? input.TexIndices[q] : input.TexIndex, input.TilingFactor,
+                     input.TexCoords ? input.TexCoords + q * 4 : DefaultTexCoords);
+        if (input.Frames) {
+            const uint32_t* rect = input.FrameRects + input.Frames[q] * 2;
+            out[i].TexRectMin = rect[0];
+            out[i].TexRectMax = rect[1];
+        }
+    }
+}
+
+const char* GetISA() { return ENG_SIMD_NAME; }
+
+} // namespace QuadKernels
+} // namespace Engine
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+
+// 24 bytes per vertex (44 with float color, UV and index). Position stays full float so depth
+// ordering is unchanged; everything else is quantized without visible loss.
+struct QuadVertex {
+    Vec3 Position;
+    uint32_t Color;       // RGBA8, read back as normalized floats
+    uint32_t TexCoord;    // two unorm16, the tiling factor is applied in the shader
+    uint16_t TilingFactor; // half float
+    uint16_t TexIndex;    // integer attribute
+};
+
+// One record per quad for the instanced pipeline; the vertex shader expands the corners.
+// 40 bytes, packed the same way as QuadVertex.
+struct QuadInstance {
+    Vec3 Position;
+    Vec2 Size;
+    float Rotation;
+    uint32_t Color;
+    uint32_t TexRectMin; // unorm16 (u, v)
+    uint32_t TexRectMax;
+    uint16_t TilingFactor;
+    uint16_t TexIndex;
+};
+
+static_assert(sizeof(QuadVertex) == 24, "QuadVertex must match Renderer2D::GetQuadVertexLayout");
+static_assert(sizeof(QuadInstance) == 40, "QuadInstance must match the instanced layout in Renderer2D::Init");
+
+// Structure-of-arrays view over a run of quads for QuadKernels::EmitQuads.
+// Positions and Sizes hold one entry per quad. The other arrays are optional; when null the
+// uniform value next to them is used for every quad. If Indices is set, run position i reads
+// quad Indices[i] from every array, which lets callers skip culled quads without copying.
+struct QuadKernelInput {
+    const uint32_t* Indices = nullptr;
+    const Vec3* Positions = nullptr;
+    const Vec2* Sizes = nullptr;
+    const float* Rotations = nullptr; // radians around +Z, null means axis-aligned
+    const Vec4* Colors = nullptr;
+    Vec4 Color = Vec4(1.0f);
+    const float* TexIndices = nullptr;
+    float TexIndex = 0.0f;
+    float TilingFactor = 1.0f;
+    const Vec2* TexCoords = nullptr; // four per quad, null means the full texture
+    // Shared UV rects picked per quad, e.g. animation frames: quad q uses rect Frames[q], stored
+    // as FrameRects[2 * rect] (min) and FrameRects[2 * rect + 1] (max), unorm16 packed like
+    // QuadVertex::TexCoord. Takes precedence over TexCoords when both are set.
+    const uint32_t* Frames = nullptr;
+    const uint32_t* FrameRects = nullptr;
+};
+
+// Quad -> vertex expansion using a 2x3 affine transform instead of a full Mat4 product.
+// Corner order matches the index buffer:
+// (3)-----(2)
+//  |       |
+// (0)-----(1)
+namespace QuadKernels {
+
+    extern const Vec2 DefaultTexCoords[4];
+    extern const uint32_t DefaultTexCoordsPacked[4];
+
+    inline void PackTexCoords(const Vec2* texCoords, uint32_t* out) {
+        if (texCoords == DefaultTexCoords) {
+            for (size_t i = 0; i < 4; i++) out[i] = DefaultTexCoordsPacked[i];
+            return;
+        }
+        for (size_t i = 0; i < 4; i++) out[i] = Math::PackUnorm2x16(texCoords[i]);
+    }
+
+    // Corners of a packed (min, max) rect; u is the low half of each word, v the high half
+    inline void PackRectTexCoords(const uint32_t* rect, uint32_t* out) {
+        out[0] = rect[0];
+        out[1] = (rect[1] & 0xffffu) | (rect[0] & 0xffff0000u);
+        out[2] = rect[1];
+        out[3] = (rect[0] & 0xffffu) | (rect[1] & 0xffff0000u);
+    }
+
+    // Single-quad scalar path with already packed corner UVs
+    inline void EmitQuad(QuadVertex* out, const Vec3& position, const Vec2& size, float rotation,
+                         const Vec4& color, float texIndex, float tilingFactor, const uint32_t* uv) {
+        float hx = size.x * 0.5f;
+        float hy = size.y * 0.5f;
+
+        // Half-axes of the quad in world space: a = R * (hx, 0), b = R * (0, hy)
+        float ax = hx, ay = 0.0f;
+        float bx = 0.0f, by = hy;
+        if (rotation != 0.0f) {
+            float c = Math::Cos(rotation);
+            float s = Math::Sin(rotation);
+            ax = c * hx; ay = s * hx;
+            bx = -s * hy; by = c * hy;
+        }
+
+        const float cornerX[4] = {-ax - bx, ax - bx, ax + bx, -ax + bx};
+        const float cornerY[4] = {-ay - by, ay - by, ay + by, -ay + by};
+        const uint32_t packedColor = Math::PackUnorm4x8(color);
+        const uint16_t packedTiling = Math::PackHalf(tilingFactor);
+        const uint16_t packedIndex = static_cast<uint16_t>(texIndex);
+        for (size_t i = 0; i < 4; i++) {
+            out[i].Position = {position.x + cornerX[i], position.y + cornerY[i], position.z};
+            out[i].Color = packedColor;
+            out[i].TexCoord = uv[i];
+            out[i].TilingFactor = packedTiling;
+            out[i].TexIndex = packedIndex;
+        }
+    }
+
+    // Single-quad scalar path, used by the immediate DrawQuad overloads.
+    inline void EmitQuad(QuadVertex* out, const Vec3& position, const Vec2& size, float rotation,
+                         const Vec4& color, float texIndex, float tilingFactor, const Vec2* texCoords) {
+        uint32_t uv[4];
+        PackTexCoords(texCoords, uv);
+        EmitQuad(out, position, size, rotation, color, texIndex, tilingFactor, uv);
+    }
+
+    // Expands run positions [first, first + count) of `input` into 4 * count vertices at `out`.
+    // Runs ENG_SIMD_WIDTH quads per iteration and skips the sin/cos work for groups that are
+    // all unrotated.
+    void EmitQuads(const QuadKernelInput& input, size_t first, size_t count, QuadVertex* out);
+
+    // Instanced counterparts: no corner math on the CPU, just a compact record per quad.
+    // texCoords[0] and texCoords[2] are taken as the min and max corners of the UV rect.
+    inline void EmitInstance(QuadInstance* out, const Vec3& position, const Vec2& size, float rotation,
+                             const Vec4& color, float texIndex, float tilingFactor, const Vec2* texCoords) {
+        out->Position = position;
+        out->Size = size;
+        out->Rotation = rotation;
+        out->Color = Math::PackUnorm4x8(color);
+        if (texCoords == DefaultTexCoords) {
+            out->TexRectMin = DefaultTexCoordsPacked[0];
+            out->TexRectMax = DefaultTexCoordsPacked[2];
+        } else {
+            out->TexRectMin = Math::PackUnorm2x16(texCoords[0]);
+            out->TexRectMax = Math::PackUnorm2x16(texCoords[2]);
+        }
+        out->TilingFactor = Math::PackHalf(tilingFactor);
+        out->TexIndex = static_cast<uint16_t>(texIndex);
+    }
+
+    void EmitInstances(const QuadKernelInput& input, size_t first, size_t count, QuadInstance* out);
+
+    // Name of the instruction set EmitQuads was compiled for.
+    const char* GetISA();
+
+}
+
+} // namespace Engine
@@ -1,12 +1,27 @@
 #include "Engine/Renderer/RenderCommand.h"
-#include "Platform/OpenGL/OpenGLRendererAPI.h"
 
 namespace Engine {
 
-RendererAPI* RenderCommand::s_RendererAPI = new OpenGLRendererAPI();
+std::unique_ptr<RendererAPI> RenderCommand::s_RendererAPI;
 
-void RenderCommand::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount) {
-    s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+RendererAPI& RenderCommand::GetRendererAPI() {
+    if (!s_RendererAPI) s_RendererAPI = RendererAPI::Create();
+    return *s_RendererAPI;
+}
+
+void RenderCommand::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                uint32_t baseVertex) {
+    GetRendererAPI().DrawIndexed(vertexArray, indexCount, baseVertex);
+}
+
+void RenderCommand::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                         uint32_t instanceCount) {
+    GetRendererAPI().DrawIndexedInstanced(vertexArray, indexCount, instanceCount);
+}
+
+void RenderCommand::DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                        uint32_t instanceCount, uint32_t baseInstance) {
+    GetRendererAPI().DrawArraysInstanced(vertexArray, vertexCount, instanceCount, baseInstance);
 }
 
 }
\ No newline at end of file
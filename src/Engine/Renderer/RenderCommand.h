@@ -8,25 +8,45 @@ namespace Engine {
 class RenderCommand {
 public:
     static void Init() {
-        s_RendererAPI->Init();
+        GetRendererAPI().Init();
     }
 
     static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-        s_RendererAPI->SetViewport(x, y, width, height);
+        GetRendererAPI().SetViewport(x, y, width, height);
     }
 
     static void SetClearColor(const glm::vec4& color) {
-        s_RendererAPI->SetClearColor(color);
+        GetRendererAPI().SetClearColor(color);
     }
 
     static void Clear() {
-        s_RendererAPI->Clear();
+        GetRendererAPI().Clear();
     }
 
-    static void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0);
+    static void SetDepthTest(bool enabled) {
+        GetRendererAPI().SetDepthTest(enabled);
+    }
+
+    static void SetBlendFunc(BlendFunc func) {
+        GetRendererAPI().SetBlendFunc(func);
+    }
+
+    static RendererCaps GetCaps() {
+        return GetRendererAPI().GetCaps();
+    }
+
+    static void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0,
+                            uint32_t baseVertex = 0);
+    static void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                     uint32_t instanceCount);
+    static void DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                    uint32_t instanceCount, uint32_t baseInstance = 0);
 
 private:
-    static RendererAPI* s_RendererAPI;
+    // Created on first use, so RendererAPI::SetAPI can still pick the backend at startup
+    static RendererAPI& GetRendererAPI();
+
+    static std::unique_ptr<RendererAPI> s_RendererAPI;
 };
 
 }
\ No newline at end of file
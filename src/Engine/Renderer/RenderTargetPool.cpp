@@ -0,0 +1,68 @@
+#include "Engine/Renderer/RenderTargetPool.h"
+
+#include <vector>
+
+namespace Engine {
+
+struct PooledTarget {
+    std::shared_ptr<Framebuffer> Target;
+    uint64_t LastUsed = 0; // frame
+};
+
+// A pool holds a handful of targets, a linear scan beats hashing the spec
+static std::vector<PooledTarget> s_Targets;
+static uint64_t s_Frame = 0;
+static uint32_t s_MaxIdleFrames = 3;
+
+static uint32_t s_Requests = 0;
+static uint32_t s_Hits = 0;
+static RenderTargetPoolStats s_LastFrame;
+
+std::shared_ptr<Framebuffer> RenderTargetPool::Acquire(const FramebufferSpec& spec) {
+    s_Requests++;
+    for (PooledTarget& pooled : s_Targets) {
+        // The pool's reference is the only one left: nobody is rendering to it
+        if (pooled.Target.use_count() == 1 && pooled.Target->GetSpec() == spec) {
+            pooled.LastUsed = s_Frame;
+            s_Hits++;
+            return pooled.Target;
+        }
+    }
+
+    std::shared_ptr<Framebuffer> target = Framebuffer::Create(spec);
+    if (!target) return nullptr;
+    s_Targets.push_back({target, s_Frame});
+    return target;
+}
+
+void RenderTargetPool::EndFrame() {
+    for (size_t i = 0; i < s_Targets.size();) {
+        PooledTarget& pooled = s_Targets[i];
+        if (pooled.Target.use_count() == 1 && s_Frame - pooled.LastUsed >= s_MaxIdleFrames) {
+            pooled = std::move(s_Targets.back());
+            s_Targets.pop_back();
+        } else {
+            i++;
+        }
+    }
+
+    s_LastFrame.Requests = s_Requests;
+    s_LastFrame.Hits = s_Hits;
+    s_Requests = 0;
+    s_Hits = 0;
+    s_Frame++;
+}
+
+void RenderTargetPool::SetMaxIdleFrames(uint32_t frames) { s_MaxIdleFrames = frames; }
+
+void RenderTargetPool::Clear() { s_Targets.clear(); }
+
+RenderTargetPoolStats RenderTargetPool::GetStats() {
+    RenderTargetPoolStats stats = s_LastFrame;
+    stats.TargetCount = static_cast<uint32_t>(s_Targets.size());
+    // Asked each time, a holder may have resized its target
+    for (const PooledTarget& pooled : s_Targets) stats.BytesHeld += pooled.Target->GetMemorySize();
+    return stats;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace Engine {
+
+struct RenderTargetPoolStats {
+    uint32_t Requests = 0;    // Acquire calls in the last finished frame
+    uint32_t Hits = 0;        // of those, served by a pooled target
+    uint32_t TargetCount = 0; // framebuffers held, in use or free
+    uint64_t BytesHeld = 0;   // GPU memory of their attachments
+
+    float GetHitRate() const { return Requests ? static_cast<float>(Hits) / Requests : 1.0f; }
+};
+
+// Frame-scoped render targets for post effects and offscreen passes. Acquire returns a pooled
+// framebuffer with exactly the requested spec, creating one only when every matching target is
+// still held by a caller. Dropping the returned pointer hands it back, so a pass can release its
+// input and reacquire the same target within the frame (ping-pong).
+//
+// Contents are undefined on Acquire; clear or fully overwrite them. Targets left unused for
+// SetMaxIdleFrames frames are destroyed at EndFrame, e.g. the old sizes after a window resize.
+class RenderTargetPool {
+public:
+    // nullptr if the spec is invalid, see Framebuffer::Create
+    static std::shared_ptr<Framebuffer> Acquire(const FramebufferSpec& spec);
+
+    // Called once per frame by Application after the layers have updated
+    static void EndFrame();
+
+    static void SetMaxIdleFrames(uint32_t frames);
+    // Drops every free target; ones still held are released when their last owner lets go
+    static void Clear();
+
+    static RenderTargetPoolStats GetStats();
+};
+
+}
@@ -1,7 +1,17 @@
 #include "Renderer2D.h"
 
+#include "Engine/Core/Profiler.h"
+#include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/GPUTimer.h"
+#include "Engine/Renderer/ParticleSystem.h"
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/RenderTargetPool.h"
 #include "Engine/Renderer/RenderCommand.h"
 #include "Engine/Renderer/Shader.h"
+#include "Engine/Renderer/SpriteGrid.h"
+#include "Engine/Renderer/TextLayout.h"
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/TextureArrayPool.h"
 #include "Engine/Renderer/VertexArray.h"
 
 #include "pch.h"
@@ -11,58 +21,322 @@
 
 namespace Engine {
 
-struct QuadVertex {
+const size_t MAX_QUADS = 20000;
+const size_t MAX_VERTICES = MAX_QUADS * 4;
+const size_t MAX_INDICES = MAX_QUADS * 6;
+// Glyph quads carry a negative tiling factor; the fragment shaders read such quads as a
+// distance field instead of a color
+const float SDF_TILING_FACTOR = -1.0f;
+
+struct TextureSlotEntry {
+    uint32_t Handle = 0; // full handle value, so a recycled registry index never matches
+    uint32_t Stamp = 0;  // batch the entry was written in
+    uint32_t Slot = 0;
+};
+
+// Deferred submission: one compact record per quad plus its sort key
+struct QuadCommand {
     Vec3 Position;
+    Vec2 Size;
+    float Rotation;
     Vec4 Color;
-    Vec2 TexCoord;
-    float TexIndex;
+    TextureHandle Texture;
     float TilingFactor;
+    Vec2 TexMin; // UV rect, corners 0 and 2 of the submitted tex coords
+    Vec2 TexMax;
 };
 
-const size_t MAX_QUADS = 20000;
-const size_t MAX_VERTICES = MAX_QUADS * 4;
-const size_t MAX_INDICES = MAX_QUADS * 6;
-const size_t MAX_TEXTURE_SLOTS = 32; // for openGL < 4.x , [TODO]: RenderCaps
+struct SortEntry {
+    uint64_t Key;
+    uint32_t Index; // into RendererData::Commands
+};
+
+// Analytic shapes: one quad each, the fragment shader evaluates the outline. Every kind has its
+// own vertex layout, stream buffer and shader and shares the quad index buffer.
+struct CircleVertex {
+    Vec3 Position;
+    Vec2 Local;      // [-1, 1] across the circle
+    uint32_t Color;  // RGBA8
+    float Thickness; // ring width as a fraction of the radius, 1 is filled
+};
+
+struct LineVertex {
+    Vec3 Position;
+    uint32_t Color;
+    float Across; // -1 on one edge of the line, 1 on the other
+};
+
+struct RoundedRectVertex {
+    Vec3 Position;
+    Vec2 Local; // world units from the center
+    uint32_t Color;
+    Vec4 Shape; // half size, corner radius, outline width (0 is filled)
+};
+
+static_assert(sizeof(CircleVertex) == 28, "CircleVertex must match its layout in Renderer2D::Init");
+static_assert(sizeof(LineVertex) == 20, "LineVertex must match its layout in Renderer2D::Init");
+static_assert(sizeof(RoundedRectVertex) == 40, "RoundedRectVertex must match its layout in Renderer2D::Init");
+
+enum class ShapeKind {
+    Circle = 0, Line, RoundedRect, Count
+};
+
+// Shapes of a kind accumulate until their buffer fills or the scene ends, independently of the
+// quad batch; the depth test orders them against quads
+struct ShapeBatch {
+    std::shared_ptr<VertexArray> Array;
+    std::shared_ptr<StreamVertexBuffer> Buffer;
+    std::shared_ptr<Shader> Program;
+    uint8_t* Base = nullptr; // mapped by the first shape of a batch
+    uint32_t Stride = 0;
+    uint32_t Count = 0;
+};
+
+// Corners in index buffer order, 0-1-2, 2-3-0
+static const Vec2 SHAPE_CORNERS[4] = {{-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f}};
 
 struct RendererData {
     std::shared_ptr<VertexArray> QuadVertexArray;
-    std::shared_ptr<VertexBuffer> QuadVertexBuffer;
+    std::shared_ptr<StreamVertexBuffer> QuadVertexBuffer;
+    std::shared_ptr<IndexBuffer> QuadIndexBuffer;
     std::shared_ptr<Shader> TextureShader;
     std::shared_ptr<Texture2D> WhiteTexture;
+    // Bound at slot 0 in Arrays mode, where TexIndex 0 means binding 0, layer 0
+    std::shared_ptr<Texture2DArray> WhiteArray;
+    TextureMode TexMode = TextureMode::Slots;
+    bool WarnedUnpooled = false;
 
-    std::unique_ptr<QuadVertex[]> QuadBufferBase;
+    // Both point into the mapped stream buffer region, vertices are written in place
+    QuadVertex* QuadBufferBase = nullptr;
     QuadVertex* QuadBufferPtr = nullptr;
 
-    uint32_t IndexCount = 0;
+    // Instanced pipeline: one QuadInstance per quad, corners expanded in quad_instanced.vert
+    std::shared_ptr<VertexArray> InstanceVertexArray;
+    std::shared_ptr<StreamVertexBuffer> InstanceVertexBuffer;
+    std::shared_ptr<Shader> InstanceShader;
+    QuadInstance* InstanceBufferBase = nullptr;
+    QuadInstance* InstanceBufferPtr = nullptr;
 
-    std::array<std::shared_ptr<Texture2D>, MAX_TEXTURE_SLOTS> TextureSlots;
+    QuadPipeline Pipeline = QuadPipeline::Batched;
+    Shader* SceneShader = nullptr;
+
+    std::array<ShapeBatch, static_cast<size_t>(ShapeKind::Count)> Shapes;
+
+    uint32_t BatchQuadCount = 0;
+
+    SubmissionMode Mode = SubmissionMode::Immediate;
+    uint8_t DrawLayer = 0;
+    BlendMode Blend = BlendMode::Opaque;
+    std::vector<QuadCommand> Commands;
+    std::vector<SortEntry> SortKeys;
+    std::vector<SortEntry> SortScratch;
+
+    // Raw pointers, resolved once per batch from the handle; no refcount traffic per quad
+    std::array<Texture*, Renderer2D::MAX_TEXTURE_SLOTS> TextureSlots{};
     uint32_t TextureSlotIndex = 1;
 
-    Vec4 QuadVertexPositions[4];
+    // Handle -> slot map indexed by TextureHandle::GetIndex(). An entry only counts when its
+    // Stamp equals BatchStamp, so a new batch invalidates the whole map with one increment.
+    std::vector<TextureSlotEntry> SlotMap;
+    uint32_t BatchStamp = 0;
+
+    // Scratch for DrawQuads: visible quad indices of the current run and resolved texture slots
+    std::vector<uint32_t> BulkIndices;
+    std::vector<float> BulkTexIndices;
+    // Dense sprite indices a SpriteGrid query returned
+    std::vector<uint32_t> GridCandidates;
+    // Bumped by every DrawTilemap, tells Tilemap which chunks went unseen the longest
+    uint32_t TilemapStamp = 0;
+    TextLayoutCache TextLayouts;
 
+    // Camera view in world space: the AABB rejects most quads, the OBB (center, unit axes and
+    // half extents) tightens it when the camera is rotated
     Vec2 CameraMin;
     Vec2 CameraMax;
+    Vec2 CameraCenter;
+    Vec2 CameraAxisX;
+    Vec2 CameraAxisY;
+    Vec2 CameraHalfExtent;
+    bool CameraRotated = false;
+
+    // Worker recording contexts, merged in creation order at EndScene
+    std::vector<std::shared_ptr<Renderer2DContext>> Contexts;
+
+    // One timer frame per scene; null without timer queries
+    std::shared_ptr<GPUTimer> Timer;
+    uint32_t SceneRange = 0;
+    RendererStats GPUStats; // only the GPU* fields, copied into Stats at every BeginScene
 
     RendererStats Stats;
+    RendererStatsHistory StatsHistory;
+    bool SceneSinceReset = false;
+    // Textures counted in Stats.UniqueTextures, indexed like SlotMap; current when equal to StatsFrame
+    std::vector<uint32_t> FrameTextureStamps;
+    uint32_t StatsFrame = 1;
 };
 
 static RendererData s_Data;
 
-void Renderer2D::Init() {
+static TextureSlotEntry& GetSlotEntry(TextureHandle handle) {
+    uint32_t index = handle.GetIndex();
+    if (index >= s_Data.SlotMap.size()) {
+        s_Data.SlotMap.resize(std::max(TextureRegistry::GetCapacity(), index + 1));
+    }
+    return s_Data.SlotMap[index];
+}
+
+// Arrays mode: the binding of the texture's array, claimed like a slot, and its layer.
+// Both the array and the texture get a SlotMap entry.
+static float FindOrAddArrayLayer(TextureHandle texture) {
+    Texture* resolved = TextureRegistry::Get(texture);
+    if (!resolved) return 0.0f;
+
+    Texture2DArray* array = resolved->GetArray();
+    if (!array) {
+        if (!s_Data.WarnedUnpooled) {
+            ENG_CORE_WARN("Renderer2D: texture was not allocated from the TextureArrayPool, drawing white");
+            s_Data.WarnedUnpooled = true;
+        }
+        return 0.0f;
+    }
+
+    TextureHandle arrayHandle = array->GetHandle();
+    TextureSlotEntry& arrayEntry = GetSlotEntry(arrayHandle);
+    if (arrayEntry.Stamp != s_Data.BatchStamp || arrayEntry.Handle != arrayHandle.GetValue()) {
+        if (s_Data.TextureSlotIndex >= Renderer2D::MAX_TEXTURE_SLOTS) {
+            return -1.0f;
+        }
+        s_Data.TextureSlots[s_Data.TextureSlotIndex] = array;
+        arrayEntry = {arrayHandle.GetValue(), s_Data.BatchStamp, s_Data.TextureSlotIndex++};
+    }
+
+    uint32_t index = (arrayEntry.Slot << Renderer2D::ARRAY_LAYER_BITS) | resolved->GetArrayLayer();
+    GetSlotEntry(texture) = {texture.GetValue(), s_Data.BatchStamp, index};
+    return static_cast<float>(index);
+}
+
+// Returns the slot of `texture` in the current batch, claiming a new one if needed,
+// or -1 when all slots are taken and the batch has to be flushed first.
+// Invalid or stale handles resolve to the white texture.
+static float FindOrAddTextureSlot(TextureHandle texture) {
+    if (!texture.IsValid()) return 0.0f;
+
+    TextureSlotEntry& entry = GetSlotEntry(texture);
+    if (entry.Stamp == s_Data.BatchStamp && entry.Handle == texture.GetValue()) {
+        return static_cast<float>(entry.Slot);
+    }
+    if (s_Data.TexMode == TextureMode::Arrays) {
+        return FindOrAddArrayLayer(texture);
+    }
+    if (s_Data.TextureSlotIndex >= Renderer2D::MAX_TEXTURE_SLOTS) {
+        return -1.0f;
+    }
+    Texture* resolved = TextureRegistry::Get(texture);
+    if (!resolved) return 0.0f;
+
+    s_Data.TextureSlots[s_Data.TextureSlotIndex] = resolved;
+    entry = {texture.GetValue(), s_Data.BatchStamp, s_Data.TextureSlotIndex};
+    return static_cast<float>(s_Data.TextureSlotIndex++);
+}
+
+static void BindTexture(const Texture* texture, uint32_t slot) {
+    texture->Bind(slot);
+    s_Data.Stats.TextureBinds++;
+
+    uint32_t index = texture->GetHandle().GetIndex();
+    if (index >= s_Data.FrameTextureStamps.size()) {
+        s_Data.FrameTextureStamps.resize(std::max(TextureRegistry::GetCapacity(), index + 1));
+    }
+    if (s_Data.FrameTextureStamps[index] != s_Data.StatsFrame) {
+        s_Data.FrameTextureStamps[index] = s_Data.StatsFrame;
+        s_Data.Stats.UniqueTextures++;
+    }
+}
+
+// Appends one quad to the current batch in whichever form the active pipeline consumes
+static void WriteQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color, float texIndex,
+                      float tilingFactor, const Vec2* texCoords) {
+    if (s_Data.Pipeline == QuadPipeline::Instanced) {
+        QuadKernels::EmitInstance(s_Data.InstanceBufferPtr, position, size, rotation, color, texIndex, tilingFactor,
+                                  texCoords);
+        s_Data.InstanceBufferPtr++;
+    } else {
+        QuadKernels::EmitQuad(s_Data.QuadBufferPtr, position, size, rotation, color, texIndex, tilingFactor,
+                              texCoords);
+        s_Data.QuadBufferPtr += 4;
+    }
+    s_Data.BatchQuadCount++;
+    s_Data.Stats.QuadCount++;
+}
+
+static void InitShapeBatch(ShapeKind kind, uint32_t stride, const BufferLayout& layout, const std::string& shader) {
+    ShapeBatch& batch = s_Data.Shapes[static_cast<size_t>(kind)];
+    batch.Array = VertexArray::Create();
+    batch.Buffer = StreamVertexBuffer::Create(MAX_VERTICES * stride);
+    batch.Buffer->SetLayout(layout);
+    batch.Array->AddVertexBuffer(batch.Buffer);
+    batch.Array->SetIndexBuffer(s_Data.QuadIndexBuffer);
+    batch.Program = Shader::Create("assets/engine/shaders/" + shader + ".vert", "assets/engine/shaders/" + shader + ".frag");
+    batch.Stride = stride;
+    batch.Base = nullptr;
+    batch.Count = 0;
+}
+
+static void FlushShapes(ShapeBatch& batch) {
+    if (batch.Count == 0) return;
+
+    uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange("Renderer2D::Batch") : 0;
+    uint32_t dataSize = batch.Count * 4 * batch.Stride;
+    uint32_t offset = batch.Buffer->Unmap(dataSize);
+
+    batch.Program->Bind();
+    RenderCommand::DrawIndexed(batch.Array, batch.Count * 6, offset / batch.Stride);
+    batch.Buffer->Fence();
+    s_Data.Stats.VertexCount += batch.Count * 4;
+    s_Data.Stats.BytesUploaded += dataSize;
+    s_Data.Stats.DrawCalls++;
+    if (s_Data.Timer) s_Data.Timer->EndRange(range);
+
+    batch.Base = nullptr;
+    batch.Count = 0;
+}
+
+// The four vertices of a new shape of `kind`, flushing the kind's batch first when it is full.
+// Shapes count as quads in the stats.
+template <typename Vertex> static Vertex* AddShape(ShapeKind kind) {
+    ShapeBatch& batch = s_Data.Shapes[static_cast<size_t>(kind)];
+    if (batch.Count == MAX_QUADS) {
+        s_Data.Stats.BatchBreaks[static_cast<size_t>(BatchBreak::VertexBufferFull)]++;
+        FlushShapes(batch);
+    }
+    if (!batch.Base) {
+        batch.Base = static_cast<uint8_t*>(batch.Buffer->Map());
+        s_Data.Stats.FenceWaitTime += batch.Buffer->GetLastWaitTime();
+    }
+    s_Data.Stats.QuadCount++;
+    return reinterpret_cast<Vertex*>(batch.Base) + 4 * batch.Count++;
+}
+
+void Renderer2D::Init(TextureMode mode) {
+    RendererCaps caps = RenderCommand::GetCaps();
+    if (caps.MaxTextureSlots < MAX_TEXTURE_SLOTS) {
+        ENG_CORE_WARN("Renderer2D: the device has {0} texture units, the quad shaders use {1}", caps.MaxTextureSlots,
+                      MAX_TEXTURE_SLOTS);
+    }
+    if (mode == TextureMode::Auto) {
+        // GL 3.0 guarantees 256 layers; with fewer, pooling would need too many arrays
+        mode = caps.MaxArrayTextureLayers >= 256 ? TextureMode::Arrays : TextureMode::Slots;
+    }
+    s_Data.TexMode = mode;
+    s_Data.WarnedUnpooled = false;
+
     s_Data.QuadVertexArray = VertexArray::Create();
 
-    s_Data.QuadVertexBuffer = VertexBuffer::Create(MAX_VERTICES * sizeof(QuadVertex));
+    s_Data.QuadVertexBuffer = StreamVertexBuffer::Create(MAX_VERTICES * sizeof(QuadVertex));
 
-    s_Data.QuadVertexBuffer->SetLayout({
-        {ShaderDataType::Float3, "a_Position"},
-        {ShaderDataType::Float4, "a_Color"},
-        {ShaderDataType::Float2, "a_TexCoord"},
-        {ShaderDataType::Float, "a_TexIndex"},
-        {ShaderDataType::Float, "a_TilingFactor"},
-    });
+    s_Data.QuadVertexBuffer->SetLayout(GetQuadVertexLayout());
 
     s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
-    s_Data.QuadBufferBase = std::make_unique<QuadVertex[]>(MAX_VERTICES);
 
     // Create Index Buffer
     auto indices = std::make_unique<uint32_t[]>(MAX_INDICES);
@@ -79,42 +353,106 @@ void Renderer2D::Init() {
         indices[idx + 5] = offset + 0;
     }
 
-    std::shared_ptr<IndexBuffer> quadIB = IndexBuffer::Create(indices.get(), MAX_INDICES);
-    s_Data.QuadVertexArray->SetIndexBuffer(quadIB);
+    s_Data.QuadIndexBuffer = IndexBuffer::Create(indices.get(), MAX_INDICES);
+    s_Data.QuadVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+
+    // Instanced pipeline
+    s_Data.InstanceVertexArray = VertexArray::Create();
+    s_Data.InstanceVertexBuffer = StreamVertexBuffer::Create(MAX_QUADS * sizeof(QuadInstance));
+    s_Data.InstanceVertexBuffer->SetLayout(BufferLayout({
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::Float2, "a_Size"},
+        {ShaderDataType::Float, "a_Rotation"},
+        {ShaderDataType::UByte4, "a_Color", true},
+        {ShaderDataType::UShort4, "a_TexRect", true},
+        {ShaderDataType::Half, "a_TilingFactor"},
+        {ShaderDataType::UShort, "a_TexIndex"},
+    }, 1));
+    s_Data.InstanceVertexArray->AddVertexBuffer(s_Data.InstanceVertexBuffer);
+    s_Data.InstanceShader = Shader::Create("assets/engine/shaders/quad_instanced.vert",
+                                           mode == TextureMode::Arrays ? "assets/engine/shaders/core_array.frag"
+                                                                       : "assets/engine/shaders/core_default.frag");
+
+    // Shape pipelines, untextured
+    InitShapeBatch(ShapeKind::Circle, sizeof(CircleVertex), {
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::Float2, "a_Local"},
+        {ShaderDataType::UByte4, "a_Color", true},
+        {ShaderDataType::Float, "a_Thickness"},
+    }, "shape_circle");
+    InitShapeBatch(ShapeKind::Line, sizeof(LineVertex), {
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::UByte4, "a_Color", true},
+        {ShaderDataType::Float, "a_Across"},
+    }, "shape_line");
+    InitShapeBatch(ShapeKind::RoundedRect, sizeof(RoundedRectVertex), {
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::Float2, "a_Local"},
+        {ShaderDataType::UByte4, "a_Color", true},
+        {ShaderDataType::Float4, "a_Shape"},
+    }, "shape_rounded_rect");
 
     s_Data.WhiteTexture = Texture2D::Create(1, 1);
     uint32_t whiteTextureData = 0xffffffff;
     s_Data.WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
-    s_Data.TextureSlots[0] = s_Data.WhiteTexture;
+    s_Data.TextureSlots[0] = s_Data.WhiteTexture.get();
+
+    if (mode == TextureMode::Arrays) {
+        s_Data.WhiteArray = Texture2DArray::Create(1, 1, 1);
+        s_Data.WhiteArray->SetData(&whiteTextureData, sizeof(uint32_t));
+        s_Data.TextureSlots[0] = s_Data.WhiteArray.get();
+        // From here on every Texture2D::Create lands in an array layer
+        TextureArrayPool::Enable(std::min(caps.MaxArrayTextureLayers, 1u << ARRAY_LAYER_BITS));
+    }
 
-    s_Data.QuadVertexPositions[0] = {-0.5f, -0.5f, 0.0f, 1.0f};
-    s_Data.QuadVertexPositions[1] = {0.5f, -0.5f, 0.0f, 1.0f};
-    s_Data.QuadVertexPositions[2] = {0.5f, 0.5f, 0.0f, 1.0f};
-    s_Data.QuadVertexPositions[3] = {-0.5f, 0.5f, 0.0f, 1.0f};
+    s_Data.Timer = GPUTimer::Create();
+    s_Data.GPUStats = {};
+    if (!s_Data.Timer) ENG_CORE_WARN("Renderer2D: no GPU timer queries, GPU stats stay at 0");
 }
 
 void Renderer2D::Shutdown() {
     // Smart pointers will release resources automatically
     s_Data.QuadVertexArray.reset();
     s_Data.QuadVertexBuffer.reset();
+    s_Data.QuadIndexBuffer.reset();
     s_Data.TextureShader.reset();
     s_Data.WhiteTexture.reset();
-    s_Data.QuadBufferBase.reset();
+    s_Data.WhiteArray.reset();
+    TextureArrayPool::Disable();
+    RenderTargetPool::Clear();
+    s_Data.QuadBufferBase = nullptr;
+    s_Data.InstanceVertexArray.reset();
+    s_Data.InstanceVertexBuffer.reset();
+    s_Data.InstanceShader.reset();
+    s_Data.InstanceBufferBase = nullptr;
+    for (ShapeBatch& batch : s_Data.Shapes) batch = {};
+    s_Data.Timer.reset();
 
-    for (auto& texture : s_Data.TextureSlots) {
-        texture.reset();
-    }
+    s_Data.TextureSlots.fill(nullptr);
+    s_Data.SlotMap.clear();
+    s_Data.Contexts.clear();
+    s_Data.TextLayouts.Clear();
 }
 
 void Renderer2D::BeginScene(const Camera& camera, Shader& shader) {
-    shader.Bind();
-    shader.SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+    ENG_PROFILE_FUNCTION();
 
     int samplers[MAX_TEXTURE_SLOTS];
     for (uint32_t i = 0; i < MAX_TEXTURE_SLOTS; i++) {
         samplers[i] = i;
     }
-    shader.SetIntArray("u_Textures", samplers, MAX_TEXTURE_SLOTS);
+
+    // The caller's shader draws the batched pipeline, our own one the instanced pipeline
+    s_Data.SceneShader = &shader;
+    for (Shader* sceneShader : {&shader, s_Data.InstanceShader.get()}) {
+        sceneShader->Bind();
+        sceneShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        sceneShader->SetIntArray("u_Textures", samplers, MAX_TEXTURE_SLOTS);
+    }
+    for (ShapeBatch& batch : s_Data.Shapes) {
+        batch.Program->Bind();
+        batch.Program->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+    }
     // Calculate camera bounds for culling
     Mat4 invViewProj = glm::inverse(camera.GetViewProjectionMatrix());
     Vec4 corners[4] = {
@@ -127,9 +465,11 @@ void Renderer2D::BeginScene(const Camera& camera, Shader& shader) {
     s_Data.CameraMin = {FLT_MAX, FLT_MAX};
     s_Data.CameraMax = {-FLT_MAX, -FLT_MAX};
 
+    Vec2 world[4];
     for (size_t i = 0; i < 4; i++) {
         Vec4 worldPos = invViewProj * corners[i];
         worldPos /= worldPos.w;
+        world[i] = {worldPos.x, worldPos.y};
 
         s_Data.CameraMin.x = glm::min(s_Data.CameraMin.x, worldPos.x);
         s_Data.CameraMin.y = glm::min(s_Data.CameraMin.y, worldPos.y);
@@ -137,34 +477,332 @@ void Renderer2D::BeginScene(const Camera& camera, Shader& shader) {
         s_Data.CameraMax.y = glm::max(s_Data.CameraMax.y, worldPos.y);
     }
 
+    Vec2 edgeX = world[1] - world[0];
+    Vec2 edgeY = world[3] - world[0];
+    s_Data.CameraCenter = (world[0] + world[2]) * 0.5f;
+    s_Data.CameraHalfExtent = {glm::length(edgeX) * 0.5f, glm::length(edgeY) * 0.5f};
+    s_Data.CameraAxisX = edgeX / (s_Data.CameraHalfExtent.x * 2.0f);
+    s_Data.CameraAxisY = edgeY / (s_Data.CameraHalfExtent.y * 2.0f);
+    // With an axis-aligned camera the AABB already is the OBB
+    s_Data.CameraRotated = Math::Abs(s_Data.CameraAxisX.y) > 1e-5f;
+
+    s_Data.DrawLayer = 0;
+    s_Data.Blend = BlendMode::Opaque;
+    s_Data.SceneSinceReset = true;
+
+    if (s_Data.Timer) {
+        if (s_Data.Timer->BeginFrame()) CollectGPUTimings();
+        s_Data.Stats.GPUSceneTime = s_Data.GPUStats.GPUSceneTime;
+        s_Data.Stats.GPUBatchTime = s_Data.GPUStats.GPUBatchTime;
+        s_Data.Stats.GPUBatchTimeMax = s_Data.GPUStats.GPUBatchTimeMax;
+        s_Data.Stats.GPUTimedBatches = s_Data.GPUStats.GPUTimedBatches;
+        s_Data.SceneRange = s_Data.Timer->BeginRange("Renderer2D::Scene");
+    }
+
     BeginBatch();
 }
 
+void Renderer2D::CollectGPUTimings() {
+    RendererStats& gpu = s_Data.GPUStats;
+    gpu = {};
+    const bool trace = Profiler::IsActive();
+    for (const GPUTimerRange& range : s_Data.Timer->GetResults()) {
+        float time = (range.End - range.Start) / 1e6f;
+        if (range.Depth == 0) {
+            gpu.GPUSceneTime += time;
+        } else {
+            gpu.GPUBatchTime += time;
+            gpu.GPUBatchTimeMax = std::max(gpu.GPUBatchTimeMax, time);
+            gpu.GPUTimedBatches++;
+        }
+        if (trace) Profiler::RecordGPU(range.Name, range.Start, range.End);
+    }
+}
+
 void Renderer2D::EndScene() {
+    ENG_PROFILE_FUNCTION();
+
     // std::cout << "[Renderer2D] EndScene called. Flushing batch..." << std::endl;
+    SubmitCommands();
+
+    bool recorded = false;
+    for (const auto& context : s_Data.Contexts) {
+        recorded |= context->GetQuadCount() > 0;
+    }
+    if (recorded) {
+        // Contexts hold pre-expanded vertices, which only the batched pipeline consumes
+        QuadPipeline pipeline = s_Data.Pipeline;
+        SetQuadPipeline(QuadPipeline::Batched);
+        for (const auto& context : s_Data.Contexts) {
+            MergeContext(*context);
+        }
+        SetQuadPipeline(pipeline);
+    }
+    for (const auto& context : s_Data.Contexts) {
+        s_Data.Stats.CulledCount += context->m_CulledCount;
+        context->Clear();
+    }
+
     EndBatch();
+    for (ShapeBatch& batch : s_Data.Shapes) FlushShapes(batch);
+
+    if (s_Data.Timer) s_Data.Timer->EndRange(s_Data.SceneRange);
+}
+
+std::shared_ptr<Renderer2DContext> Renderer2D::CreateContext() {
+    s_Data.Contexts.push_back(std::make_shared<Renderer2DContext>());
+    return s_Data.Contexts.back();
+}
+
+// Maps the segment's texture table onto batch slots. Fails without side effects on the quads
+// when the batch cannot take all of them; a fresh batch always can.
+static bool ResolveSegmentTextures(const TextureHandle* textures, uint32_t count, uint16_t* remap, bool& identity) {
+    remap[0] = 0;
+    identity = true;
+    for (uint32_t i = 1; i <= count; i++) {
+        float slot = FindOrAddTextureSlot(textures[i - 1]);
+        if (slot < 0.0f) return false;
+        remap[i] = static_cast<uint16_t>(slot);
+        identity &= remap[i] == i;
+    }
+    return true;
+}
+
+void Renderer2D::MergeContext(Renderer2DContext& context) {
+    uint16_t remap[MAX_TEXTURE_SLOTS];
+    bool identity = true;
+
+    for (const Renderer2DContext::Segment& segment : context.m_Segments) {
+        const TextureHandle* textures = context.m_SegmentTextures.data() + segment.FirstTexture;
+        size_t quad = segment.FirstQuad;
+        size_t end = quad + segment.QuadCount;
+        bool resolved = false;
+
+        while (quad < end) {
+            if (s_Data.BatchQuadCount == MAX_QUADS) {
+                NextBatch(BatchBreak::VertexBufferFull);
+                resolved = false;
+            }
+            if (!resolved) {
+                resolved = ResolveSegmentTextures(textures, segment.TextureCount, remap, identity);
+                if (!resolved) {
+                    NextBatch(BatchBreak::TextureSlotsFull);
+                    continue;
+                }
+            }
+
+            size_t count = std::min(end - quad, MAX_QUADS - s_Data.BatchQuadCount);
+            const QuadVertex* src = context.m_Vertices.data() + quad * 4;
+            if (identity) {
+                // Common case: the segment's slots line up with the batch, copy it wholesale
+                memcpy(s_Data.QuadBufferPtr, src, count * 4 * sizeof(QuadVertex));
+            } else {
+                for (size_t v = 0; v < count * 4; v++) {
+                    s_Data.QuadBufferPtr[v] = src[v];
+                    s_Data.QuadBufferPtr[v].TexIndex = remap[src[v].TexIndex];
+                }
+            }
+            s_Data.QuadBufferPtr += count * 4;
+            s_Data.BatchQuadCount += static_cast<uint32_t>(count);
+            s_Data.Stats.QuadCount += static_cast<uint32_t>(count);
+            quad += count;
+        }
+    }
 }
 
 void Renderer2D::BeginBatch() {
-    s_Data.QuadBufferPtr = s_Data.QuadBufferBase.get();
-    s_Data.IndexCount = 0;
+    // Map the next ring region of the active pipeline; this is where a fence wait would happen
+    if (s_Data.Pipeline == QuadPipeline::Instanced) {
+        s_Data.InstanceBufferBase = static_cast<QuadInstance*>(s_Data.InstanceVertexBuffer->Map());
+        s_Data.InstanceBufferPtr = s_Data.InstanceBufferBase;
+        s_Data.Stats.FenceWaitTime += s_Data.InstanceVertexBuffer->GetLastWaitTime();
+    } else {
+        s_Data.QuadBufferBase = static_cast<QuadVertex*>(s_Data.QuadVertexBuffer->Map());
+        s_Data.QuadBufferPtr = s_Data.QuadBufferBase;
+        s_Data.Stats.FenceWaitTime += s_Data.QuadVertexBuffer->GetLastWaitTime();
+    }
+    s_Data.BatchQuadCount = 0;
     s_Data.TextureSlotIndex = 1;
+
+    s_Data.BatchStamp++;
+    TextureHandle white = s_Data.WhiteTexture->GetHandle();
+    GetSlotEntry(white) = {white.GetValue(), s_Data.BatchStamp, 0};
 }
 
 void Renderer2D::EndBatch() {
-    uint32_t dataSize = (uint8_t*)s_Data.QuadBufferPtr - (uint8_t*)s_Data.QuadBufferBase.get();
+    if (s_Data.BatchQuadCount == 0) return;
+    ENG_PROFILE_FUNCTION();
 
-    if (dataSize > 0) {
-        // Upload data to GPU
-        s_Data.QuadVertexBuffer->SetData(s_Data.QuadBufferBase.get(), dataSize);
+    for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++) {
+        BindTexture(s_Data.TextureSlots[i], i);
+    }
+
+    uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange("Renderer2D::Batch") : 0;
+
+    if (s_Data.Pipeline == QuadPipeline::Instanced) {
+        // One record per quad, 6 vertices generated per instance
+        uint32_t dataSize = s_Data.BatchQuadCount * sizeof(QuadInstance);
+        uint32_t offset = s_Data.InstanceVertexBuffer->Unmap(dataSize);
+
+        s_Data.InstanceShader->Bind();
+        RenderCommand::DrawArraysInstanced(s_Data.InstanceVertexArray, 6, s_Data.BatchQuadCount,
+                                           offset / sizeof(QuadInstance));
+        s_Data.InstanceVertexBuffer->Fence();
+        s_Data.Stats.VertexCount += s_Data.BatchQuadCount * 6;
+        s_Data.Stats.BytesUploaded += dataSize;
+    } else {
+        uint32_t dataSize = s_Data.BatchQuadCount * 4 * sizeof(QuadVertex);
+        uint32_t offset = s_Data.QuadVertexBuffer->Unmap(dataSize);
+
+        s_Data.SceneShader->Bind();
+        RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.BatchQuadCount * 6, offset / sizeof(QuadVertex));
+        s_Data.QuadVertexBuffer->Fence();
+        s_Data.Stats.VertexCount += s_Data.BatchQuadCount * 4;
+        s_Data.Stats.BytesUploaded += dataSize;
+    }
+    if (s_Data.Timer) s_Data.Timer->EndRange(range);
+    s_Data.Stats.DrawCalls++;
+}
+
+TextureMode Renderer2D::GetTextureMode() { return s_Data.TexMode; }
+
+void Renderer2D::SetQuadPipeline(QuadPipeline pipeline) {
+    if (pipeline == s_Data.Pipeline) return;
+
+    // Already-written quads belong to the old pipeline's buffer
+    if (s_Data.BatchQuadCount > 0) s_Data.Stats.BatchBreaks[static_cast<size_t>(BatchBreak::PipelineChange)]++;
+    EndBatch();
+    s_Data.Pipeline = pipeline;
+    BeginBatch();
+}
+
+QuadPipeline Renderer2D::GetQuadPipeline() { return s_Data.Pipeline; }
+
+const BufferLayout& Renderer2D::GetQuadVertexLayout() {
+    static const BufferLayout layout = {
+        {ShaderDataType::Float3, "a_Position"},
+        {ShaderDataType::UByte4, "a_Color", true},
+        {ShaderDataType::UShort2, "a_TexCoord", true},
+        {ShaderDataType::Half, "a_TilingFactor"},
+        {ShaderDataType::UShort, "a_TexIndex"},
+    };
+    return layout;
+}
+
+const std::shared_ptr<IndexBuffer>& Renderer2D::GetQuadIndexBuffer() { return s_Data.QuadIndexBuffer; }
+
+void Renderer2D::SetSubmissionMode(SubmissionMode mode) {
+    if (mode == s_Data.Mode) return;
 
-        for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++) {
-            s_Data.TextureSlots[i]->Bind(i);
+    // Queued commands were submitted before the switch, draw them first
+    SubmitCommands();
+    s_Data.Mode = mode;
+}
+
+SubmissionMode Renderer2D::GetSubmissionMode() { return s_Data.Mode; }
+
+void Renderer2D::SetDrawLayer(uint8_t layer) { s_Data.DrawLayer = layer; }
+
+void Renderer2D::SetBlendMode(BlendMode mode) { s_Data.Blend = mode; }
+
+void Renderer2D::NextBatch(BatchBreak reason) {
+    if (s_Data.BatchQuadCount > 0) s_Data.Stats.BatchBreaks[static_cast<size_t>(reason)]++;
+    EndBatch();
+    BeginBatch();
+}
+
+// Sort key, most significant first:
+//   layer:8 | translucent:1 | opaque: texture:20 depth:16 (front to back)
+//                           | translucent: submission sequence:32
+// Opaque quads of a layer are grouped by texture so batches only break once per 31 textures,
+// and drawn front to back for early depth rejection. Translucent quads keep submission order.
+static uint64_t MakeSortKey(float z, const Vec4& color, TextureHandle texture, uint32_t sequence) {
+    uint64_t key = static_cast<uint64_t>(s_Data.DrawLayer) << 56;
+    if (s_Data.Blend == BlendMode::Alpha || color.a < 1.0f) {
+        return key | (1ull << 55) | sequence;
+    }
+
+    // Order-preserving float -> uint mapping, inverted so that larger z (nearer) sorts first
+    uint32_t bits;
+    memcpy(&bits, &z, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    uint64_t depth = static_cast<uint64_t>(~bits >> 16);
+    return key | (static_cast<uint64_t>(texture.GetIndex()) << 35) | (depth << 19);
+}
+
+static void EnqueueQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                        TextureHandle texture, float tilingFactor, const Vec2& texMin, const Vec2& texMax) {
+    uint32_t index = static_cast<uint32_t>(s_Data.Commands.size());
+    s_Data.Commands.push_back({position, size, rotation, color, texture, tilingFactor, texMin, texMax});
+    s_Data.SortKeys.push_back({MakeSortKey(position.z, color, texture, index), index});
+}
+
+static void EnqueueQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                        TextureHandle texture, float tilingFactor,
+                        const Vec2* texCoords = QuadKernels::DefaultTexCoords) {
+    EnqueueQuad(position, size, rotation, color, texture, tilingFactor, texCoords[0], texCoords[2]);
+}
+
+// Stable LSD radix sort, one byte per pass. Bytes that are equal across all keys (typically
+// most of the layer and depth bits) are skipped.
+static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+    if (entries.size() < 2) return;
+    scratch.resize(entries.size());
+
+    uint64_t varying = 0;
+    for (const SortEntry& entry : entries) {
+        varying |= entry.Key ^ entries[0].Key;
+    }
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        if (((varying >> shift) & 0xff) == 0) continue;
+
+        uint32_t offsets[256] = {};
+        for (const SortEntry& entry : entries) {
+            offsets[(entry.Key >> shift) & 0xff]++;
         }
-        // Draw
-        RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.IndexCount);
-        s_Data.Stats.DrawCalls++;
+        uint32_t sum = 0;
+        for (uint32_t& offset : offsets) {
+            uint32_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (const SortEntry& entry : entries) {
+            scratch[offsets[(entry.Key >> shift) & 0xff]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void Renderer2D::SubmitCommands() {
+    if (s_Data.Commands.empty()) return;
+
+    RadixSort(s_Data.SortKeys, s_Data.SortScratch);
+    for (const SortEntry& entry : s_Data.SortKeys) {
+        const QuadCommand& command = s_Data.Commands[entry.Index];
+        if (s_Data.BatchQuadCount >= MAX_QUADS) {
+            NextBatch(BatchBreak::VertexBufferFull);
+        }
+        float textureIndex = FindOrAddTextureSlot(command.Texture);
+        if (textureIndex < 0.0f) {
+            NextBatch(BatchBreak::TextureSlotsFull);
+            textureIndex = FindOrAddTextureSlot(command.Texture);
+        }
+        const Vec2* texCoords = QuadKernels::DefaultTexCoords;
+        Vec2 rect[4];
+        if (command.TexMin != texCoords[0] || command.TexMax != texCoords[2]) {
+            rect[0] = command.TexMin;
+            rect[1] = {command.TexMax.x, command.TexMin.y};
+            rect[2] = command.TexMax;
+            rect[3] = {command.TexMin.x, command.TexMax.y};
+            texCoords = rect;
+        }
+        WriteQuad(command.Position, command.Size, command.Rotation, command.Color, textureIndex,
+                  command.TilingFactor, texCoords);
     }
+
+    s_Data.Commands.clear();
+    s_Data.SortKeys.clear();
 }
 
 void Renderer2D::Flush() {
@@ -179,6 +817,16 @@ void Renderer2D::DrawQuad(const Vec3& position, const Vec2& size, const Vec4& co
     DrawRotatedQuad(position, size, 0.0f, color);
 }
 
+void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, TextureHandle texture, float tilingFactor,
+                          const Vec4& tintColor) {
+    DrawQuad({position.x, position.y, 0.0f}, size, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawQuad(const Vec3& position, const Vec2& size, TextureHandle texture, float tilingFactor,
+                          const Vec4& tintColor) {
+    DrawRotatedQuad(position, size, 0.0f, texture, tilingFactor, tintColor);
+}
+
 void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const std::shared_ptr<Texture2D>& texture,
                          float tilingFactor, const Vec4& tintColor) {
     DrawQuad({position.x, position.y, 0.0f}, size, texture, tilingFactor, tintColor);
@@ -194,36 +842,21 @@ void Renderer2D::DrawRotatedQuad(const Vec2& position, const Vec2& size, float r
 }
 
 void Renderer2D::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color) {
-    if (s_Data.IndexCount >= MAX_INDICES) {
-        EndBatch();
-        BeginBatch();
+    if (!IsOnScreen({position.x, position.y}, size, rotation)) {
+        s_Data.Stats.CulledCount++;
+        return;
+    }
+    if (s_Data.Mode == SubmissionMode::Deferred) {
+        EnqueueQuad(position, size, rotation, color, TextureHandle(), 1.0f);
+        return;
+    }
+    if (s_Data.BatchQuadCount >= MAX_QUADS) {
+        NextBatch(BatchBreak::VertexBufferFull);
     }
-    Mat4 transform =
-        Mat4::Translate(position) * Mat4::Rotate(rotation, -Vec3::Right()) * Mat4::Scale(Vec3(size.x, size.y, 1.0f));
     const float textureIndex = 0.0f; // White Texture
     const float tilingFactor = 1.0f;
-    const Vec2 texCoords[] = {
-        {0.0f, 0.0f},
-        {1.0f, 0.0f},
-        {1.0f, 1.0f},
-        {0.0f, 1.0f},
-    };
-    // Quad
-    // (3)-----(2)
-    //  |       |
-    // (0)-----(1)
-    if (!IsOnScreen({position.x, position.y}, size)) return;
-    for (size_t i = 0; i < 4; i++) {
-        s_Data.QuadBufferPtr->Position =
-            transform * Vec4(s_Data.QuadVertexPositions[i].x, s_Data.QuadVertexPositions[i].y, 0.0f, 1.0f);
-        s_Data.QuadBufferPtr->Color = color;
-        s_Data.QuadBufferPtr->TexCoord = texCoords[i];
-        s_Data.QuadBufferPtr->TexIndex = textureIndex;
-        s_Data.QuadBufferPtr->TilingFactor = tilingFactor;
-        s_Data.QuadBufferPtr++;
-    }
-    s_Data.IndexCount += 6;
-    s_Data.Stats.QuadCount++;
+
+    WriteQuad(position, size, rotation, color, textureIndex, tilingFactor, QuadKernels::DefaultTexCoords);
 }
 
 void Renderer2D::DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation,
@@ -235,71 +868,457 @@ void Renderer2D::DrawRotatedQuad(const Vec2& position, const Vec2& size, float r
 void Renderer2D::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation,
                                  const std::shared_ptr<Texture2D>& texture, float tilingFactor,
                                  const Vec4& tintColor) {
-    if (!texture) {
-        DrawRotatedQuad(position, size, 0.0f, {1.0f, 0.0f, 1.0f, 1.0f}); // Fallback color
+    DrawRotatedQuad(position, size, rotation, texture ? texture->GetHandle() : TextureHandle(), tilingFactor,
+                    tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation, TextureHandle texture,
+                                 float tilingFactor, const Vec4& tintColor) {
+    DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation, texture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, TextureHandle texture,
+                                 float tilingFactor, const Vec4& tintColor) {
+    DrawTexturedQuad(position, size, rotation, texture, tilingFactor, tintColor, QuadKernels::DefaultTexCoords);
+}
+
+void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const std::shared_ptr<SubTexture2D>& subTexture,
+                          float tilingFactor, const Vec4& tintColor) {
+    DrawQuad({position.x, position.y, 0.0f}, size, subTexture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawQuad(const Vec3& position, const Vec2& size, const std::shared_ptr<SubTexture2D>& subTexture,
+                          float tilingFactor, const Vec4& tintColor) {
+    DrawRotatedQuad(position, size, 0.0f, subTexture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation,
+                                 const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor,
+                                 const Vec4& tintColor) {
+    DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation, subTexture, tilingFactor, tintColor);
+}
+
+void Renderer2D::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation,
+                                 const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor,
+                                 const Vec4& tintColor) {
+    if (!subTexture || !subTexture->GetTexture()) {
+        DrawRotatedQuad(position, size, rotation, TextureHandle(), tilingFactor, tintColor);
         return;
     }
-    if (s_Data.IndexCount >= MAX_INDICES) {
-        EndBatch();
-        BeginBatch();
-    }
-    Mat4 transform =
-        Mat4::Translate(position) * Mat4::Rotate(rotation, -Vec3::Right()) * Mat4::Scale(Vec3(size.x, size.y, 1.0f));
-    float textureIndex = 0.0f; // White Texture
-    const Vec2 texCoords[] = {
-        {0.0f, 0.0f},
-        {1.0f, 0.0f},
-        {1.0f, 1.0f},
-        {0.0f, 1.0f},
-    };
+    DrawTexturedQuad(position, size, rotation, subTexture->GetTexture()->GetHandle(), tilingFactor, tintColor,
+                     subTexture->GetTexCoords());
+}
+
+void Renderer2D::DrawTexturedQuad(const Vec3& position, const Vec2& size, float rotation, TextureHandle texture,
+                                  float tilingFactor, const Vec4& tintColor, const Vec2* texCoords) {
+    if (!texture.IsValid()) {
+        DrawRotatedQuad(position, size, rotation, {1.0f, 0.0f, 1.0f, 1.0f}); // Fallback color
+        return;
+    }
+    // Cull before touching texture slots, a culled quad must never cause a flush
+    if (!IsOnScreen({position.x, position.y}, size, rotation)) {
+        s_Data.Stats.CulledCount++;
+        return;
+    }
+    if (s_Data.Mode == SubmissionMode::Deferred) {
+        EnqueueQuad(position, size, rotation, tintColor, texture, tilingFactor, texCoords);
+        return;
+    }
+    if (s_Data.BatchQuadCount >= MAX_QUADS) {
+        NextBatch(BatchBreak::VertexBufferFull);
+    }
+    float textureIndex = FindOrAddTextureSlot(texture);
+    if (textureIndex < 0.0f) {
+        NextBatch(BatchBreak::TextureSlotsFull);
+        textureIndex = FindOrAddTextureSlot(texture);
+    }
 
-    for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
-        if (*s_Data.TextureSlots[i] == *texture) {
-            textureIndex = (float)i;
-            break;
+    WriteQuad(position, size, rotation, tintColor, textureIndex, tilingFactor, texCoords);
+}
+
+void Renderer2D::DrawQuads(const QuadSpan& quads) { DrawQuadSubset(quads, nullptr, quads.Count); }
+
+void Renderer2D::DrawSpriteGrid(const SpriteGrid& grid) {
+    s_Data.GridCandidates.clear();
+    grid.QueryCandidates(s_Data.CameraMin, s_Data.CameraMax, s_Data.GridCandidates);
+
+    QuadSpan span;
+    span.Count = grid.GetCount();
+    span.Positions = grid.m_Positions.data();
+    span.Sizes = grid.m_Sizes.data();
+    span.Rotations = grid.m_Rotations.data();
+    span.Colors = grid.m_Colors.data();
+    span.Textures = grid.m_Textures.data();
+    DrawQuadSubset(span, s_Data.GridCandidates.data(), s_Data.GridCandidates.size());
+}
+
+void Renderer2D::DrawQuadSubset(const QuadSpan& quads, const uint32_t* candidates, size_t candidateCount) {
+    // Cull the whole span first so nothing below is spent on quads that are off screen
+    if (s_Data.BulkIndices.size() < candidateCount) s_Data.BulkIndices.resize(candidateCount);
+    size_t visibleCount = 0;
+    for (size_t c = 0; c < candidateCount; c++) {
+        uint32_t i = candidates ? candidates[c] : static_cast<uint32_t>(c);
+        const Vec3& position = quads.Positions[i];
+        float rotation = quads.Rotations ? quads.Rotations[i] : 0.0f;
+        if (IsOnScreen({position.x, position.y}, quads.Sizes[i], rotation)) {
+            s_Data.BulkIndices[visibleCount++] = i;
         }
     }
-    if (textureIndex == 0.0f) {
-        if (s_Data.TextureSlotIndex >= MAX_TEXTURE_SLOTS) {
-            EndBatch();
-            BeginBatch();
+    s_Data.Stats.CulledCount += static_cast<uint32_t>(candidateCount - visibleCount);
+
+    if (s_Data.Mode == SubmissionMode::Deferred) {
+        for (size_t i = 0; i < visibleCount; i++) {
+            uint32_t q = s_Data.BulkIndices[i];
+            Vec2 texMin = QuadKernels::DefaultTexCoords[0], texMax = QuadKernels::DefaultTexCoords[2];
+            if (quads.Frames) {
+                const uint32_t* rect = quads.FrameRects + quads.Frames[q] * 2;
+                texMin = Math::UnpackUnorm2x16(rect[0]);
+                texMax = Math::UnpackUnorm2x16(rect[1]);
+            }
+            EnqueueQuad(quads.Positions[q], quads.Sizes[q], quads.Rotations ? quads.Rotations[q] : 0.0f,
+                        quads.Colors ? quads.Colors[q] : quads.Color,
+                        quads.Textures ? quads.Textures[q] : quads.Texture, quads.TilingFactor, texMin, texMax);
         }
-        textureIndex = (float)s_Data.TextureSlotIndex;
-        s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-        s_Data.TextureSlotIndex++;
+        return;
     }
-    
 
-    if (!IsOnScreen({position.x, position.y}, size)) return;
-    for (size_t i = 0; i < 4; i++) {
-        s_Data.QuadBufferPtr->Position =
-            transform * Vec4(s_Data.QuadVertexPositions[i].x, s_Data.QuadVertexPositions[i].y, 0.0f, 1.0f);
-        s_Data.QuadBufferPtr->Color = tintColor;
-        s_Data.QuadBufferPtr->TexCoord = texCoords[i];
-        s_Data.QuadBufferPtr->TexIndex = textureIndex;
-        s_Data.QuadBufferPtr->TilingFactor = tilingFactor;
-        s_Data.QuadBufferPtr++;
-    }
-    s_Data.IndexCount += 6;
-    s_Data.Stats.QuadCount++;
+    QuadKernelInput input;
+    input.Indices = s_Data.BulkIndices.data();
+    input.Positions = quads.Positions;
+    input.Sizes = quads.Sizes;
+    input.Rotations = quads.Rotations;
+    input.Colors = quads.Colors;
+    input.Color = quads.Color;
+    input.TilingFactor = quads.TilingFactor;
+    input.Frames = quads.Frames;
+    input.FrameRects = quads.FrameRects;
+    if (quads.Textures) {
+        if (s_Data.BulkTexIndices.size() < quads.Count) s_Data.BulkTexIndices.resize(quads.Count);
+        input.TexIndices = s_Data.BulkTexIndices.data();
+    }
+
+    size_t next = 0;
+    while (next < visibleCount) {
+        size_t room = MAX_QUADS - s_Data.BatchQuadCount;
+        if (!quads.Textures && quads.Texture.IsValid()) input.TexIndex = FindOrAddTextureSlot(quads.Texture);
+        if (room == 0 || input.TexIndex < 0.0f) {
+            NextBatch(room == 0 ? BatchBreak::VertexBufferFull : BatchBreak::TextureSlotsFull);
+            continue;
+        }
+
+        // Resolve per-quad textures until the batch runs out of room or texture slots
+        size_t end = std::min(visibleCount, next + room);
+        size_t last = next;
+        if (quads.Textures) {
+            for (; last < end; last++) {
+                uint32_t q = s_Data.BulkIndices[last];
+                float slot = FindOrAddTextureSlot(quads.Textures[q]);
+                if (slot < 0.0f) break;
+                s_Data.BulkTexIndices[q] = slot;
+            }
+        } else {
+            last = end;
+        }
+
+        size_t count = last - next;
+        if (s_Data.Pipeline == QuadPipeline::Instanced) {
+            QuadKernels::EmitInstances(input, next, count, s_Data.InstanceBufferPtr);
+            s_Data.InstanceBufferPtr += count;
+        } else {
+            QuadKernels::EmitQuads(input, next, count, s_Data.QuadBufferPtr);
+            s_Data.QuadBufferPtr += count * 4;
+        }
+        s_Data.BatchQuadCount += static_cast<uint32_t>(count);
+        s_Data.Stats.QuadCount += static_cast<uint32_t>(count);
+
+        if (last < visibleCount) {
+            NextBatch(last == end ? BatchBreak::VertexBufferFull : BatchBreak::TextureSlotsFull);
+        }
+        next = last;
+    }
 }
 
-bool Renderer2D::IsOnScreen(const Vec2& pos, const Vec2& size) {
-    float objMinX = pos.x - size.x * 0.5f;
-    float objMaxX = pos.x + size.x * 0.5f;
-    float objMinY = pos.y - size.y * 0.5f;
-    float objMaxY = pos.y + size.y * 0.5f;
+void Renderer2D::DrawStaticBatch(StaticBatch& batch) {
+    uint32_t quadCount = batch.GetQuadCount();
+    if (quadCount == 0) return;
 
-    if (objMaxX < s_Data.CameraMin.x) return false;
-    if (objMinX > s_Data.CameraMax.x) return false;
-    if (objMaxY < s_Data.CameraMin.y) return false;
-    if (objMinY > s_Data.CameraMax.y) return false;
+    // One test for the whole batch
+    Vec2 center = (batch.m_BoundsMin + batch.m_BoundsMax) * 0.5f;
+    if (!IsOnScreen(center, batch.m_BoundsMax - batch.m_BoundsMin, 0.0f)) {
+        s_Data.Stats.CulledCount += quadCount;
+        return;
+    }
+
+    // Streamed quads submitted so far go first, and the batch needs the texture units to itself
+    if (s_Data.BatchQuadCount > 0) s_Data.Stats.BatchBreaks[static_cast<size_t>(BatchBreak::StaticBatch)]++;
+    EndBatch();
+
+    s_Data.Stats.BytesUploaded += batch.Upload();
+    BindTexture(s_Data.TextureSlots[0], 0);
+    for (size_t i = 0; i < batch.m_Textures.size(); i++) {
+        Texture* texture = TextureRegistry::Get(batch.m_Textures[i]);
+        BindTexture(texture ? texture : s_Data.WhiteTexture.get(), static_cast<uint32_t>(i + 1));
+    }
+
+    // The shared index buffer covers MAX_QUADS quads, larger batches are drawn in chunks
+    uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange("Renderer2D::StaticBatch") : 0;
+    s_Data.SceneShader->Bind();
+    for (uint32_t first = 0; first < quadCount; first += MAX_QUADS) {
+        uint32_t count = std::min<uint32_t>(quadCount - first, MAX_QUADS);
+        RenderCommand::DrawIndexed(batch.m_VertexArray, count * 6, first * 4);
+        s_Data.Stats.DrawCalls++;
+    }
+    if (s_Data.Timer) s_Data.Timer->EndRange(range);
+    s_Data.Stats.QuadCount += quadCount;
+    s_Data.Stats.VertexCount += quadCount * 4;
+
+    BeginBatch();
+}
+
+void Renderer2D::DrawTilemap(Tilemap& tilemap) {
+    if (tilemap.m_Chunks.empty()) return;
+
+    // Chunks overlapping the camera AABB; the map is axis-aligned, so no OBB test here
+    const Vec2 chunkSize = tilemap.m_TileSize * static_cast<float>(Tilemap::CHUNK_SIZE);
+    const Vec2 origin = {tilemap.m_Origin.x, tilemap.m_Origin.y};
+    const Vec2 first = glm::floor((s_Data.CameraMin - origin) / chunkSize);
+    const Vec2 last = glm::floor((s_Data.CameraMax - origin) / chunkSize);
+    if (last.x < 0.0f || last.y < 0.0f || first.x >= tilemap.m_ChunksX || first.y >= tilemap.m_ChunksY) return;
+
+    const uint32_t x0 = static_cast<uint32_t>(std::max(first.x, 0.0f));
+    const uint32_t y0 = static_cast<uint32_t>(std::max(first.y, 0.0f));
+    const uint32_t x1 = std::min(static_cast<uint32_t>(last.x), tilemap.m_ChunksX - 1);
+    const uint32_t y1 = std::min(static_cast<uint32_t>(last.y), tilemap.m_ChunksY - 1);
+
+    if (s_Data.BatchQuadCount > 0) s_Data.Stats.BatchBreaks[static_cast<size_t>(BatchBreak::StaticBatch)]++;
+    EndBatch();
+
+    const uint32_t stamp = ++s_Data.TilemapStamp;
+    uint32_t range = s_Data.Timer ? s_Data.Timer->BeginRange("Renderer2D::Tilemap") : 0;
+    BindTexture(s_Data.TextureSlots[0], 0);
+    if (tilemap.m_Texture) {
+        Texture* texture = tilemap.m_Texture.get();
+        BindTexture(texture->GetArray() ? static_cast<Texture*>(texture->GetArray()) : texture, 1);
+    }
+    s_Data.SceneShader->Bind();
+
+    for (uint32_t y = y0; y <= y1; y++) {
+        for (uint32_t x = x0; x <= x1; x++) {
+            uint32_t index = y * tilemap.m_ChunksX + x;
+            s_Data.Stats.BytesUploaded += tilemap.PrepareChunk(index, stamp);
+
+            const Tilemap::Chunk& chunk = tilemap.m_Chunks[index];
+            if (chunk.QuadCount == 0) continue;
+            RenderCommand::DrawIndexed(chunk.Array, chunk.QuadCount * 6);
+            s_Data.Stats.DrawCalls++;
+            s_Data.Stats.QuadCount += chunk.QuadCount;
+            s_Data.Stats.VertexCount += chunk.QuadCount * 4;
+        }
+    }
+    if (s_Data.Timer) s_Data.Timer->EndRange(range);
+
+    BeginBatch();
+}
+
+void Renderer2D::DrawParticles(const ParticleSystem& particles) {
+    const size_t count = particles.GetCount();
+    if (count == 0) return;
+
+    const Vec2 center = (particles.GetBoundsMin() + particles.GetBoundsMax()) * 0.5f;
+    if (!IsOnScreen(center, particles.GetBoundsMax() - particles.GetBoundsMin(), 0.0f)) {
+        s_Data.Stats.CulledCount += static_cast<uint32_t>(count);
+        return;
+    }
+
+    const TextureHandle texture = particles.GetTexture();
+    float textureIndex = -1.0f;
+    size_t next = 0;
+    while (next < count) {
+        const size_t room = MAX_QUADS - s_Data.BatchQuadCount;
+        if (room == 0) {
+            NextBatch(BatchBreak::VertexBufferFull);
+            textureIndex = -1.0f;
+            continue;
+        }
+        // Resolved once per batch, not per particle
+        if (textureIndex < 0.0f) {
+            textureIndex = FindOrAddTextureSlot(texture);
+            if (textureIndex < 0.0f) {
+                NextBatch(BatchBreak::TextureSlotsFull);
+                continue;
+            }
+        }
+
+        const size_t run = std::min(room, count - next);
+        if (s_Data.Pipeline == QuadPipeline::Instanced) {
+            particles.EmitInstances(next, run, textureIndex, s_Data.InstanceBufferPtr);
+            s_Data.InstanceBufferPtr += run;
+        } else {
+            particles.EmitQuads(next, run, textureIndex, s_Data.QuadBufferPtr);
+            s_Data.QuadBufferPtr += run * 4;
+        }
+        s_Data.BatchQuadCount += static_cast<uint32_t>(run);
+        s_Data.Stats.QuadCount += static_cast<uint32_t>(run);
+        next += run;
+    }
+}
+
+void Renderer2D::DrawLine(const Vec2& start, const Vec2& end, const Vec4& color, float thickness) {
+    DrawLine({start.x, start.y, 0.0f}, {end.x, end.y, 0.0f}, color, thickness);
+}
+
+void Renderer2D::DrawLine(const Vec3& start, const Vec3& end, const Vec4& color, float thickness) {
+    const Vec2 delta = {end.x - start.x, end.y - start.y};
+    const float length = glm::length(delta);
+    if (length == 0.0f || thickness <= 0.0f) return;
+    const Vec2 center = {(start.x + end.x) * 0.5f, (start.y + end.y) * 0.5f};
+    if (!IsOnScreen(center, {Math::Abs(delta.x) + thickness, Math::Abs(delta.y) + thickness}, 0.0f)) {
+        s_Data.Stats.CulledCount++;
+        return;
+    }
+
+    const Vec2 normal = Vec2(-delta.y, delta.x) * (thickness * 0.5f / length);
+    const uint32_t packed = Math::PackUnorm4x8(color);
+    LineVertex* out = AddShape<LineVertex>(ShapeKind::Line);
+    out[0] = {{start.x - normal.x, start.y - normal.y, start.z}, packed, -1.0f};
+    out[1] = {{end.x - normal.x, end.y - normal.y, end.z}, packed, -1.0f};
+    out[2] = {{end.x + normal.x, end.y + normal.y, end.z}, packed, 1.0f};
+    out[3] = {{start.x + normal.x, start.y + normal.y, start.z}, packed, 1.0f};
+}
+
+void Renderer2D::DrawCircle(const Vec2& center, float radius, const Vec4& color, float thickness) {
+    DrawCircle({center.x, center.y, 0.0f}, radius, color, thickness);
+}
+
+void Renderer2D::DrawCircle(const Vec3& center, float radius, const Vec4& color, float thickness) {
+    if (radius <= 0.0f) return;
+    if (!IsOnScreen({center.x, center.y}, Vec2(radius * 2.0f), 0.0f)) {
+        s_Data.Stats.CulledCount++;
+        return;
+    }
+
+    const uint32_t packed = Math::PackUnorm4x8(color);
+    const float ring = thickness > 0.0f && thickness < radius ? thickness / radius : 1.0f;
+    CircleVertex* out = AddShape<CircleVertex>(ShapeKind::Circle);
+    for (size_t v = 0; v < 4; v++) {
+        const Vec2& corner = SHAPE_CORNERS[v];
+        out[v] = {{center.x + corner.x * radius, center.y + corner.y * radius, center.z}, corner, packed, ring};
+    }
+}
+
+void Renderer2D::DrawRoundedRect(const Vec2& position, const Vec2& size, float radius, const Vec4& color,
+                                 float thickness) {
+    DrawRoundedRect({position.x, position.y, 0.0f}, size, radius, color, thickness);
+}
+
+void Renderer2D::DrawRoundedRect(const Vec3& position, const Vec2& size, float radius, const Vec4& color,
+                                 float thickness) {
+    if (!IsOnScreen({position.x, position.y}, size, 0.0f)) {
+        s_Data.Stats.CulledCount++;
+        return;
+    }
+
+    const Vec2 half = size * 0.5f;
+    const Vec4 shape = {half.x, half.y, std::min(std::max(radius, 0.0f), std::min(half.x, half.y)),
+                        std::max(thickness, 0.0f)};
+    const uint32_t packed = Math::PackUnorm4x8(color);
+    RoundedRectVertex* out = AddShape<RoundedRectVertex>(ShapeKind::RoundedRect);
+    for (size_t v = 0; v < 4; v++) {
+        const Vec2 local = SHAPE_CORNERS[v] * half;
+        out[v] = {{position.x + local.x, position.y + local.y, position.z}, local, packed, shape};
+    }
+}
+
+void Renderer2D::DrawString(std::string_view text, const Font& font, const Vec3& position, float size,
+                            const Vec4& color) {
+    const TextLayout& layout = s_Data.TextLayouts.Get(text, font, size);
+    if (layout.Glyphs.empty()) return;
+
+    const uint32_t glyphCount = static_cast<uint32_t>(layout.Glyphs.size());
+    const Vec2 center = Vec2(position.x, position.y) + (layout.Min + layout.Max) * 0.5f;
+    if (!IsOnScreen(center, layout.Max - layout.Min, 0.0f)) {
+        s_Data.Stats.CulledCount += glyphCount;
+        return;
+    }
+
+    const TextureHandle atlas = font.GetAtlasTexture()->GetHandle();
+    if (s_Data.Mode == SubmissionMode::Deferred) {
+        // Glyph edges are blended, so keep submission order like any translucent quad
+        BlendMode blend = s_Data.Blend;
+        s_Data.Blend = BlendMode::Alpha;
+        for (const TextGlyph& glyph : layout.Glyphs) {
+            EnqueueQuad({position.x + glyph.Center.x, position.y + glyph.Center.y, position.z}, glyph.Size, 0.0f,
+                        color, atlas, SDF_TILING_FACTOR, glyph.TexCoords);
+        }
+        s_Data.Blend = blend;
+        return;
+    }
+
+    float textureIndex = -1.0f;
+    for (const TextGlyph& glyph : layout.Glyphs) {
+        if (s_Data.BatchQuadCount >= MAX_QUADS) {
+            NextBatch(BatchBreak::VertexBufferFull);
+            textureIndex = -1.0f;
+        }
+        // Resolved once per batch, not per glyph
+        if (textureIndex < 0.0f) {
+            textureIndex = FindOrAddTextureSlot(atlas);
+            if (textureIndex < 0.0f) {
+                NextBatch(BatchBreak::TextureSlotsFull);
+                textureIndex = FindOrAddTextureSlot(atlas);
+            }
+        }
+        WriteQuad({position.x + glyph.Center.x, position.y + glyph.Center.y, position.z}, glyph.Size, 0.0f, color,
+                  textureIndex, SDF_TILING_FACTOR, glyph.TexCoords);
+    }
+}
+
+TextLayoutCache& Renderer2D::GetTextLayoutCache() { return s_Data.TextLayouts; }
+
+// Separating axis test of the quad's rotated bounding box against the camera: the world axes
+// first (camera AABB), then the camera's own axes when it is rotated. Only rotated quads pay
+// for a sin/cos here.
+bool Renderer2D::IsOnScreen(const Vec2& pos, const Vec2& size, float rotation) {
+    float hx = size.x * 0.5f;
+    float hy = size.y * 0.5f;
+    float extentX = hx;
+    float extentY = hy;
+    if (rotation != 0.0f) {
+        float c = Math::Abs(Math::Cos(rotation));
+        float s = Math::Abs(Math::Sin(rotation));
+        extentX = c * hx + s * hy;
+        extentY = s * hx + c * hy;
+    }
+
+    if (pos.x + extentX < s_Data.CameraMin.x) return false;
+    if (pos.x - extentX > s_Data.CameraMax.x) return false;
+    if (pos.y + extentY < s_Data.CameraMin.y) return false;
+    if (pos.y - extentY > s_Data.CameraMax.y) return false;
+
+    if (!s_Data.CameraRotated) return true;
+
+    Vec2 d = pos - s_Data.CameraCenter;
+    const Vec2& axisX = s_Data.CameraAxisX;
+    const Vec2& axisY = s_Data.CameraAxisY;
+    float radiusX = extentX * Math::Abs(axisX.x) + extentY * Math::Abs(axisX.y);
+    if (Math::Abs(glm::dot(d, axisX)) > s_Data.CameraHalfExtent.x + radiusX) return false;
+    float radiusY = extentX * Math::Abs(axisY.x) + extentY * Math::Abs(axisY.y);
+    if (Math::Abs(glm::dot(d, axisY)) > s_Data.CameraHalfExtent.y + radiusY) return false;
 
     return true;
 }
 
 RendererStats& Renderer2D::GetStats() { return s_Data.Stats; }
 
-void Renderer2D::ResetStats() { memset(&s_Data.Stats, 0, sizeof(RendererStats)); }
+void Renderer2D::ResetStats() {
+    if (s_Data.SceneSinceReset) s_Data.StatsHistory.Push(s_Data.Stats);
+    s_Data.SceneSinceReset = false;
+    s_Data.Stats = {};
+    s_Data.StatsFrame++;
+}
+
+const RendererStatsHistory& Renderer2D::GetStatsHistory() { return s_Data.StatsHistory; }
+
+void Renderer2D::SetStatsHistorySize(uint32_t frames) { s_Data.StatsHistory.SetCapacity(frames); }
 
 } // namespace Engine
\ No newline at end of file
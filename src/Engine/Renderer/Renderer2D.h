@@ -1,48 +1,209 @@
 #pragma once
 
 #include "Engine/Renderer/Camera.h"
+#include "Engine/Renderer/Renderer2DContext.h"
+#include "Engine/Renderer/RendererStats.h"
+#include "Engine/Renderer/StaticBatch.h"
+#include "Engine/Renderer/SubTexture2D.h"
 #include "Engine/Renderer/Texture.h" 
 #include "Engine/Renderer/Shader.h"
 #include "Engine/Core/Math.h"
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace Engine {
 
-struct RendererStats {
-    uint32_t DrawCalls = 0;
-    uint32_t QuadCount = 0;
+class BufferLayout;
+class Font;
+class IndexBuffer;
+class ParticleSystem;
+class SpriteGrid;
+class TextLayoutCache;
+class Tilemap;
+
+// Structure-of-arrays view over `Count` sprites for Renderer2D::DrawQuads.
+// Positions and Sizes are required. The other arrays are optional and fall back to the
+// uniform value below them when null; an invalid handle in Textures draws untextured.
+struct QuadSpan {
+    size_t Count = 0;
+    const Vec3* Positions = nullptr;
+    const Vec2* Sizes = nullptr;
+    const float* Rotations = nullptr;
+    const Vec4* Colors = nullptr;
+    const TextureHandle* Textures = nullptr;
+    // Per-quad UV rects out of a shared table, see QuadKernelInput::Frames and SpriteAnimation.
+    // Both null means every quad samples the whole texture.
+    const uint32_t* Frames = nullptr;
+    const uint32_t* FrameRects = nullptr;
+
+    Vec4 Color = Vec4(1.0f);
+    TextureHandle Texture;
+    float TilingFactor = 1.0f;
+};
+
+// How quads reach the GPU. Batched writes four vertices per quad against a static index buffer;
+// Instanced writes one compact record per quad and expands the corners in the vertex shader.
+enum class QuadPipeline {
+    Batched = 0, Instanced
+};
+
+// Immediate writes quads into the current batch as they are submitted. Deferred queues compact
+// commands and sorts them by layer, blend mode, texture and depth at EndScene, so interleaved
+// textures no longer split batches.
+enum class SubmissionMode {
+    Immediate = 0, Deferred
+};
+
+// Alpha quads (and any quad with color alpha < 1) keep their submission order within a layer
+// in deferred mode; opaque ones may be reordered and rely on the depth test.
+enum class BlendMode {
+    Opaque = 0, Alpha
+};
+
+// How a batch addresses its textures. Slots binds up to MAX_TEXTURE_SLOTS sampler2Ds and the
+// vertex TexIndex picks one. Arrays binds up to MAX_TEXTURE_SLOTS sampler2DArrays from the
+// TextureArrayPool and TexIndex packs the binding and the layer, so a batch reaches hundreds of
+// textures. The scene shader has to match, see core_default.frag and core_array.frag.
+// Auto picks Arrays when the device supports enough array layers.
+enum class TextureMode {
+    Auto = 0, Slots, Arrays
 };
 
 class Renderer2D {
 public:
-    static void Init();
+    static constexpr uint32_t MAX_TEXTURE_SLOTS = 32; // bindings per batch, the shaders declare as many samplers
+    // TextureMode::Arrays: TexIndex = binding << ARRAY_LAYER_BITS | layer
+    static constexpr uint32_t ARRAY_LAYER_BITS = 11;
+
+    // The texture mode is fixed until Shutdown. Textures created before Init are never pooled
+    // and draw white in Arrays mode.
+    static void Init(TextureMode mode = TextureMode::Auto);
     static void Shutdown();
 
+    static TextureMode GetTextureMode();
+
     static void BeginScene(const Camera& camera, Shader& shader);
     static void EndScene();
+
+    // Can be switched at any time, including mid-scene (flushes the current batch)
+    static void SetQuadPipeline(QuadPipeline pipeline);
+    static QuadPipeline GetQuadPipeline();
+
+    // Switching out of Deferred mid-scene draws the queued commands first
+    static void SetSubmissionMode(SubmissionMode mode);
+    static SubmissionMode GetSubmissionMode();
+
+    // Sort state for deferred submission, both reset at BeginScene. Higher layers draw on top.
+    static void SetDrawLayer(uint8_t layer);
+    static void SetBlendMode(BlendMode mode);
     
     // Colored Quad
     static void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color);
     static void DrawQuad(const Vec3& position, const Vec2& size, const Vec4& color);
     
     // Textured Quad
+    // Textures are referenced by handle until the batch is flushed, so they must outlive EndScene.
+    // The shared_ptr overloads just forward texture->GetHandle(). Negative tiling factors are
+    // reserved for DrawString glyphs.
+    static void DrawQuad(const Vec2& position, const Vec2& size, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    static void DrawQuad(const Vec3& position, const Vec2& size, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
     static void DrawQuad(const Vec2& position, const Vec2& size, const std::shared_ptr<Texture2D>& texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
     static void DrawQuad(const Vec3& position, const Vec2& size, const std::shared_ptr<Texture2D>& texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+
+    // Sub-region of a texture, e.g. a sprite sheet cell or a TextureAtlas region. Sprites sharing
+    // an atlas page share a texture slot.
+    static void DrawQuad(const Vec2& position, const Vec2& size, const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    static void DrawQuad(const Vec3& position, const Vec2& size, const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
     
+    // Rotation is in radians, counter-clockwise around +Z
     static void DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation, const Vec4& color);
     static void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color);
+    static void DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    static void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
     static void DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation, const std::shared_ptr<Texture2D>& texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
     static void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const std::shared_ptr<Texture2D>& texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    static void DrawRotatedQuad(const Vec2& position, const Vec2& size, float rotation, const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    static void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const std::shared_ptr<SubTexture2D>& subTexture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+
+    // Bulk submission: culls, resolves textures and expands the whole span in one pass,
+    // splitting batches internally. Prefer this over per-sprite DrawQuad for large sets.
+    static void DrawQuads(const QuadSpan& quads);
+
+    // Draws retained geometry right away with the scene shader, uploading pending changes first.
+    // In deferred mode it lands before every queued quad.
+    static void DrawStaticBatch(StaticBatch& batch);
+
+    // Draws the grid's sprites in cells near the camera view, through the DrawQuads path.
+    // Sprites in cells that were never visited are not counted in CulledCount.
+    static void DrawSpriteGrid(const SpriteGrid& grid);
+
+    // Draws the chunks of the map that intersect the camera view, building dirty ones first.
+    // Like DrawStaticBatch it flushes the current batch and lands before queued deferred quads.
+    static void DrawTilemap(Tilemap& tilemap);
+
+    // Writes every live particle straight into the current batch, splitting batches as it fills
+    // them. The system is culled as a whole by its bounds. Like DrawStaticBatch it bypasses deferred
+    // sorting and lands before queued deferred quads. Rotating particles are cheaper on
+    // QuadPipeline::Instanced, the batched path pays a sin/cos per particle.
+    static void DrawParticles(const ParticleSystem& particles);
+
+    // Analytic shapes, one quad each with the outline computed per pixel, so edges stay smooth at
+    // any zoom. Each kind has its own batch, drawn when it fills and at EndScene; the depth test
+    // orders shapes against quads. They bypass deferred sorting. Thickness is in world units.
+    // Lines have square ends and take their z from each endpoint.
+    static void DrawLine(const Vec2& start, const Vec2& end, const Vec4& color, float thickness = 0.01f);
+    static void DrawLine(const Vec3& start, const Vec3& end, const Vec4& color, float thickness = 0.01f);
+    // A thickness of 0 (or at least the radius) fills the circle, anything less draws a ring
+    static void DrawCircle(const Vec2& center, float radius, const Vec4& color, float thickness = 0.0f);
+    static void DrawCircle(const Vec3& center, float radius, const Vec4& color, float thickness = 0.0f);
+    // Axis-aligned; a thickness of 0 fills, anything more draws an outline inside the rect.
+    // The radius is clamped to half the shorter side.
+    static void DrawRoundedRect(const Vec2& position, const Vec2& size, float radius, const Vec4& color,
+                                float thickness = 0.0f);
+    static void DrawRoundedRect(const Vec3& position, const Vec2& size, float radius, const Vec4& color,
+                                float thickness = 0.0f);
+
+    // UTF-8 text in the font's distance field atlas. `position` is the left end of the first
+    // baseline and `size` the em height, both in world units. Layouts are cached per (text, font,
+    // size), and the glyphs are ordinary quads in the current batch, so text and sprites share
+    // draw calls. The string is culled as a whole.
+    static void DrawString(std::string_view text, const Font& font, const Vec3& position, float size,
+                           const Vec4& color = Vec4(1.0f));
+    static TextLayoutCache& GetTextLayoutCache();
+
+    // Recording context for a worker thread, merged at every EndScene. Contexts live until Shutdown;
+    // create them up front on the render thread, one per worker.
+    static std::shared_ptr<Renderer2DContext> CreateContext();
 
     static RendererStats& GetStats();
+    // Ends the stats frame: pushes the counters into the history if a scene ran since the last
+    // call, then zeroes them. Call once per frame, before the first BeginScene.
     static void ResetStats();
+    static const RendererStatsHistory& GetStatsHistory();
+    static void SetStatsHistorySize(uint32_t frames);
     
     private:
+    friend class Renderer2DContext;
+    friend class StaticBatch;
+    friend class Tilemap;
+
+    // Shared with StaticBatch and Tilemap, which draw QuadVertex data against the same index buffer
+    static const BufferLayout& GetQuadVertexLayout();
+    static const std::shared_ptr<IndexBuffer>& GetQuadIndexBuffer();
+
     static void Flush();
     static void BeginBatch();
     static void EndBatch();
-    static bool IsOnScreen(const Vec2& pos, const Vec2& size);
+    static void NextBatch(BatchBreak reason);
+    static void CollectGPUTimings();
+    static void SubmitCommands();
+    static void DrawTexturedQuad(const Vec3& position, const Vec2& size, float rotation, TextureHandle texture,
+                                 float tilingFactor, const Vec4& tintColor, const Vec2* texCoords);
+    static bool IsOnScreen(const Vec2& pos, const Vec2& size, float rotation);
+    static void MergeContext(Renderer2DContext& context);
+    // DrawQuads over quads[candidates[i]], or over the whole span when candidates is null
+    static void DrawQuadSubset(const QuadSpan& quads, const uint32_t* candidates, size_t candidateCount);
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "Engine/Renderer/Renderer2DContext.h"
+#include "Engine/Renderer/Renderer2D.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+// Texture slots a segment may use, slot 0 is the white texture
+static const uint32_t SEGMENT_TEXTURE_SLOTS = Renderer2D::MAX_TEXTURE_SLOTS - 1;
+
+void Renderer2DContext::OpenSegment() {
+    Segment segment;
+    segment.FirstQuad = static_cast<uint32_t>(GetQuadCount());
+    segment.FirstTexture = static_cast<uint32_t>(m_SegmentTextures.size());
+    m_Segments.push_back(segment);
+    // Invalidates every lookup entry of the previous segment
+    m_SegmentStamp++;
+}
+
+// Slot of `texture` in the open segment, opening a new segment when its table is full.
+// Only touches this context's own tables, never the registry, so it is safe on any thread.
+float Renderer2DContext::LocalTextureSlot(TextureHandle texture) {
+    if (!texture.IsValid()) return 0.0f;
+    if (m_Segments.empty()) OpenSegment();
+
+    uint32_t index = texture.GetIndex();
+    if (index >= m_TextureLookup.size()) {
+        m_TextureLookup.resize(std::max<size_t>(index + 1, m_TextureLookup.size() * 2));
+    }
+    TextureLookup& entry = m_TextureLookup[index];
+    if (entry.Stamp == m_SegmentStamp && entry.Handle == texture.GetValue()) {
+        return static_cast<float>(entry.Slot);
+    }
+
+    if (m_Segments.back().TextureCount == SEGMENT_TEXTURE_SLOTS) OpenSegment();
+    Segment& segment = m_Segments.back();
+    m_SegmentTextures.push_back(texture);
+    entry = {texture.GetValue(), m_SegmentStamp, ++segment.TextureCount};
+    return static_cast<float>(entry.Slot);
+}
+
+// Whether `texture` can be used without opening a new segment
+bool Renderer2DContext::FitsOpenSegment(TextureHandle texture) const {
+    if (!texture.IsValid() || m_Segments.empty()) return true;
+    if (m_Segments.back().TextureCount < SEGMENT_TEXTURE_SLOTS) return true;
+
+    uint32_t index = texture.GetIndex();
+    return index < m_TextureLookup.size() && m_TextureLookup[index].Stamp == m_SegmentStamp &&
+           m_TextureLookup[index].Handle == texture.GetValue();
+}
+
+// Room for `quadCount` quads at the end of the open segment
+QuadVertex* Renderer2DContext::Allocate(size_t quadCount) {
+    if (m_Segments.empty()) OpenSegment();
+    size_t first = m_Vertices.size();
+    m_Vertices.resize(first + quadCount * 4);
+    m_Segments.back().QuadCount += static_cast<uint32_t>(quadCount);
+    return m_Vertices.data() + first;
+}
+
+void Renderer2DContext::Clear() {
+    m_Vertices.clear();
+    m_Segments.clear();
+    m_SegmentTextures.clear();
+    m_CulledCount = 0;
+}
+
+void Renderer2DContext::DrawQuad(const Vec3& position, const Vec2& size, const Vec4& color) {
+    DrawRotatedQuad(position, size, 0.0f, color);
+}
+
+void Renderer2DContext::DrawQuad(const Vec3& position, const Vec2& size, TextureHandle texture, float tilingFactor,
+                                 const Vec4& tintColor) {
+    DrawRotatedQuad(position, size, 0.0f, texture, tilingFactor, tintColor);
+}
+
+void Renderer2DContext::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color) {
+    if (!Renderer2D::IsOnScreen({position.x, position.y}, size, rotation)) {
+        m_CulledCount++;
+        return;
+    }
+    QuadKernels::EmitQuad(Allocate(1), position, size, rotation, color, 0.0f, 1.0f, QuadKernels::DefaultTexCoords);
+}
+
+void Renderer2DContext::DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation,
+                                        TextureHandle texture, float tilingFactor, const Vec4& tintColor) {
+    if (!texture.IsValid()) {
+        DrawRotatedQuad(position, size, rotation, {1.0f, 0.0f, 1.0f, 1.0f}); // Fallback color
+        return;
+    }
+    if (!Renderer2D::IsOnScreen({position.x, position.y}, size, rotation)) {
+        m_CulledCount++;
+        return;
+    }
+    // Resolve first, it may open a new segment that the quad then has to land in
+    float textureIndex = LocalTextureSlot(texture);
+    QuadKernels::EmitQuad(Allocate(1), position, size, rotation, tintColor, textureIndex, tilingFactor,
+                          QuadKernels::DefaultTexCoords);
+}
+
+void Renderer2DContext::DrawQuads(const QuadSpan& quads) {
+    if (m_BulkIndices.size() < quads.Count) m_BulkIndices.resize(quads.Count);
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < quads.Count; i++) {
+        const Vec3& position = quads.Positions[i];
+        float rotation = quads.Rotations ? quads.Rotations[i] : 0.0f;
+        if (Renderer2D::IsOnScreen({position.x, position.y}, quads.Sizes[i], rotation)) {
+            m_BulkIndices[visibleCount++] = static_cast<uint32_t>(i);
+        }
+    }
+    m_CulledCount += static_cast<uint32_t>(quads.Count - visibleCount);
+
+    QuadKernelInput input;
+    input.Indices = m_BulkIndices.data();
+    input.Positions = quads.Positions;
+    input.Sizes = quads.Sizes;
+    input.Rotations = quads.Rotations;
+    input.Colors = quads.Colors;
+    input.Color = quads.Color;
+    input.TilingFactor = quads.TilingFactor;
+    input.Frames = quads.Frames;
+    input.FrameRects = quads.FrameRects;
+
+    if (!quads.Textures) {
+        input.TexIndex = LocalTextureSlot(quads.Texture);
+        QuadKernels::EmitQuads(input, 0, visibleCount, Allocate(visibleCount));
+        return;
+    }
+
+    if (m_BulkTexIndices.size() < quads.Count) m_BulkTexIndices.resize(quads.Count);
+    input.TexIndices = m_BulkTexIndices.data();
+
+    // Emit in runs that stay within one segment
+    size_t next = 0;
+    while (next < visibleCount) {
+        size_t last = next;
+        for (; last < visibleCount; last++) {
+            uint32_t q = m_BulkIndices[last];
+            if (last > next && !FitsOpenSegment(quads.Textures[q])) break;
+            m_BulkTexIndices[q] = LocalTextureSlot(quads.Textures[q]);
+        }
+        QuadKernels::EmitQuads(input, next, last - next, Allocate(last - next));
+        next = last;
+    }
+}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/TextureRegistry.h"
+#include "Engine/Core/Math.h"
+
+#include <vector>
+
+namespace Engine {
+
+struct QuadSpan;
+
+// Records quads on a worker thread. Each thread fills its own context between
+// Renderer2D::BeginScene and EndScene; culling and vertex expansion happen here, in parallel.
+// EndScene merges all contexts in creation order (after the quads submitted through Renderer2D
+// directly) and issues the GL calls on the render thread, so the output is deterministic.
+//
+// A context must only be used by one thread at a time, and all recording has to be finished
+// before EndScene. Create contexts with Renderer2D::CreateContext().
+class Renderer2DContext {
+public:
+    void DrawQuad(const Vec3& position, const Vec2& size, const Vec4& color);
+    void DrawQuad(const Vec3& position, const Vec2& size, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color);
+    void DrawRotatedQuad(const Vec3& position, const Vec2& size, float rotation, TextureHandle texture, float tilingFactor = 1.0f, const Vec4& tintColor = Vec4(1.0f));
+    void DrawQuads(const QuadSpan& quads);
+
+    size_t GetQuadCount() const { return m_Vertices.size() / 4; }
+
+private:
+    friend class Renderer2D;
+
+    // A run of quads sharing one table of at most MAX_TEXTURE_SLOTS - 1 textures. Vertex
+    // TexIndex values are slots into that table (0 is white) and get remapped at merge time.
+    struct Segment {
+        uint32_t FirstQuad = 0;
+        uint32_t QuadCount = 0;
+        uint32_t FirstTexture = 0; // into m_SegmentTextures
+        uint32_t TextureCount = 0;
+    };
+
+    struct TextureLookup {
+        uint32_t Handle = 0;
+        uint32_t Stamp = 0;
+        uint32_t Slot = 0;
+    };
+
+    float LocalTextureSlot(TextureHandle texture);
+    bool FitsOpenSegment(TextureHandle texture) const;
+    void OpenSegment();
+    QuadVertex* Allocate(size_t quadCount);
+    void Clear();
+
+    std::vector<QuadVertex> m_Vertices;
+    std::vector<Segment> m_Segments;
+    std::vector<TextureHandle> m_SegmentTextures;
+    // Handle index -> slot in the open segment, valid while Stamp matches m_SegmentStamp
+    std::vector<TextureLookup> m_TextureLookup;
+    uint32_t m_SegmentStamp = 0;
+
+    std::vector<uint32_t> m_BulkIndices;
+    std::vector<float> m_BulkTexIndices;
+
+    uint32_t m_CulledCount = 0;
+};
+
+}
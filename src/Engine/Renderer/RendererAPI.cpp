@@ -1,5 +1,6 @@
 #include "RendererAPI.h"
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Capture/CaptureRendererAPI.h"
 
 namespace Engine {
 
@@ -9,6 +10,7 @@ std::unique_ptr<RendererAPI> RendererAPI::Create() {
     switch (s_API) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_unique<OpenGLRendererAPI>();
+        case RendererAPI::API::Capture: return std::make_unique<CaptureRendererAPI>();
     }
     return nullptr;
 }
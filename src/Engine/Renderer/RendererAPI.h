@@ -6,10 +6,24 @@
 
 namespace Engine {
 
+// Device limits, queried from the current context
+struct RendererCaps {
+    uint32_t MaxTextureSlots = 0;       // texture units a fragment shader can sample
+    uint32_t MaxTextureSize = 0;
+    uint32_t MaxArrayTextureLayers = 0; // 0 without texture array support
+};
+
+// Fixed-function blending of fragment outputs into the bound target
+enum class BlendFunc {
+    None = 0, Alpha, Additive
+};
+
 class RendererAPI {
 public:
+    // Capture draws nothing and records every command into CaptureRecorder, for headless
+    // benchmarks and for diffing renderer output between revisions
     enum class API {
-        None = 0, OpenGL = 1
+        None = 0, OpenGL = 1, Capture = 2
     };
 
 public:
@@ -19,10 +33,23 @@ public:
     virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
     virtual void SetClearColor(const glm::vec4& color) = 0;
     virtual void Clear() = 0;
+    virtual RendererCaps GetCaps() const = 0;
+
+    // Init turns on the depth test (LEQUAL) and alpha blending; whoever changes them restores them
+    virtual void SetDepthTest(bool enabled) = 0;
+    virtual void SetBlendFunc(BlendFunc func) = 0;
 
-    virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+    // baseVertex / baseInstance offset into the vertex buffers, e.g. into a StreamVertexBuffer region
+    virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0,
+                             uint32_t baseVertex = 0) = 0;
+    virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                      uint32_t instanceCount) = 0;
+    virtual void DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                     uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
 
     static API GetAPI() { return s_API; }
+    // Only before the first renderer object is created
+    static void SetAPI(API api) { s_API = api; }
     static std::unique_ptr<RendererAPI> Create();
 
 private:
@@ -0,0 +1,117 @@
+#include "Engine/Renderer/RendererStats.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Engine {
+
+const char* GetRendererCounterName(RendererCounter counter) {
+    switch (counter) {
+        case RendererCounter::DrawCalls:             return "DrawCalls";
+        case RendererCounter::QuadCount:             return "QuadCount";
+        case RendererCounter::VertexCount:           return "VertexCount";
+        case RendererCounter::CulledCount:           return "CulledCount";
+        case RendererCounter::BytesUploaded:         return "BytesUploaded";
+        case RendererCounter::TextureBinds:          return "TextureBinds";
+        case RendererCounter::UniqueTextures:        return "UniqueTextures";
+        case RendererCounter::BreakVertexBufferFull: return "Break.VertexBufferFull";
+        case RendererCounter::BreakTextureSlotsFull: return "Break.TextureSlotsFull";
+        case RendererCounter::BreakPipelineChange:   return "Break.PipelineChange";
+        case RendererCounter::BreakStaticBatch:      return "Break.StaticBatch";
+        case RendererCounter::FenceWaitTime:         return "FenceWaitTime(ms)";
+        case RendererCounter::GPUSceneTime:          return "GPUSceneTime(ms)";
+        case RendererCounter::GPUBatchTime:          return "GPUBatchTime(ms)";
+        case RendererCounter::GPUBatchTimeMax:       return "GPUBatchTimeMax(ms)";
+        case RendererCounter::Count:                 break;
+    }
+    return "";
+}
+
+float RendererStats::Get(RendererCounter counter) const {
+    switch (counter) {
+        case RendererCounter::DrawCalls:             return static_cast<float>(DrawCalls);
+        case RendererCounter::QuadCount:             return static_cast<float>(QuadCount);
+        case RendererCounter::VertexCount:           return static_cast<float>(VertexCount);
+        case RendererCounter::CulledCount:           return static_cast<float>(CulledCount);
+        case RendererCounter::BytesUploaded:         return static_cast<float>(BytesUploaded);
+        case RendererCounter::TextureBinds:          return static_cast<float>(TextureBinds);
+        case RendererCounter::UniqueTextures:        return static_cast<float>(UniqueTextures);
+        case RendererCounter::BreakVertexBufferFull:
+            return static_cast<float>(BatchBreaks[static_cast<size_t>(BatchBreak::VertexBufferFull)]);
+        case RendererCounter::BreakTextureSlotsFull:
+            return static_cast<float>(BatchBreaks[static_cast<size_t>(BatchBreak::TextureSlotsFull)]);
+        case RendererCounter::BreakPipelineChange:
+            return static_cast<float>(BatchBreaks[static_cast<size_t>(BatchBreak::PipelineChange)]);
+        case RendererCounter::BreakStaticBatch:
+            return static_cast<float>(BatchBreaks[static_cast<size_t>(BatchBreak::StaticBatch)]);
+        case RendererCounter::FenceWaitTime:         return FenceWaitTime;
+        case RendererCounter::GPUSceneTime:          return GPUSceneTime;
+        case RendererCounter::GPUBatchTime:          return GPUBatchTime;
+        case RendererCounter::GPUBatchTimeMax:       return GPUBatchTimeMax;
+        case RendererCounter::Count:                 break;
+    }
+    return 0.0f;
+}
+
+RendererStatsHistory::RendererStatsHistory(uint32_t frames) : m_Frames(std::max(frames, 1u)) {}
+
+void RendererStatsHistory::Push(const RendererStats& stats) {
+    Frame& frame = m_Frames[m_Next];
+    for (size_t i = 0; i < frame.size(); i++) {
+        frame[i] = stats.Get(static_cast<RendererCounter>(i));
+    }
+    m_Next = (m_Next + 1) % m_Frames.size();
+    m_Count = std::min<uint32_t>(m_Count + 1, static_cast<uint32_t>(m_Frames.size()));
+}
+
+void RendererStatsHistory::Clear() {
+    m_Next = 0;
+    m_Count = 0;
+}
+
+void RendererStatsHistory::SetCapacity(uint32_t frames) {
+    m_Frames.assign(std::max(frames, 1u), Frame{});
+    Clear();
+}
+
+RendererCounterSummary RendererStatsHistory::Summarize(RendererCounter counter) const {
+    RendererCounterSummary summary;
+    if (m_Count == 0) return summary;
+
+    // The stored frames are the first m_Count slots until the ring wraps, then all of them
+    const size_t index = static_cast<size_t>(counter);
+    m_Scratch.resize(m_Count);
+    double sum = 0.0;
+    for (uint32_t i = 0; i < m_Count; i++) {
+        m_Scratch[i] = m_Frames[i][index];
+        sum += m_Scratch[i];
+    }
+
+    auto [min, max] = std::minmax_element(m_Scratch.begin(), m_Scratch.end());
+    summary.Min = *min;
+    summary.Max = *max;
+    summary.Avg = static_cast<float>(sum / m_Count);
+
+    // Nearest rank: the smallest value with at least 99% of the frames at or below it
+    size_t rank = (static_cast<size_t>(m_Count) * 99 + 99) / 100 - 1;
+    std::nth_element(m_Scratch.begin(), m_Scratch.begin() + rank, m_Scratch.end());
+    summary.P99 = m_Scratch[rank];
+    return summary;
+}
+
+std::string RendererStatsHistory::ToString() const {
+    std::string text;
+    char line[128];
+    std::snprintf(line, sizeof(line), "Renderer2D stats over %u frames (min / avg / p99 / max)", m_Count);
+    text += line;
+    for (size_t i = 0; i < static_cast<size_t>(RendererCounter::Count); i++) {
+        RendererCounter counter = static_cast<RendererCounter>(i);
+        RendererCounterSummary summary = Summarize(counter);
+        std::snprintf(line, sizeof(line), "\n  %-24s %12.2f %12.2f %12.2f %12.2f", GetRendererCounterName(counter),
+                      summary.Min, summary.Avg, summary.P99, summary.Max);
+        text += line;
+    }
+    return text;
+}
+
+}
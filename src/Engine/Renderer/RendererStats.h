@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// Why a batch was drawn before EndScene. StaticBatch covers every retained geometry draw,
+// DrawStaticBatch and DrawTilemap.
+enum class BatchBreak {
+    VertexBufferFull = 0, TextureSlotsFull, PipelineChange, StaticBatch, Count
+};
+
+// Every RendererStats value as a flat index, for RendererStatsHistory
+enum class RendererCounter {
+    DrawCalls = 0, QuadCount, VertexCount, CulledCount, BytesUploaded, TextureBinds, UniqueTextures,
+    BreakVertexBufferFull, BreakTextureSlotsFull, BreakPipelineChange, BreakStaticBatch,
+    FenceWaitTime, GPUSceneTime, GPUBatchTime, GPUBatchTimeMax, Count
+};
+
+const char* GetRendererCounterName(RendererCounter counter);
+
+// Renderer2D counters for one frame, which runs from one Renderer2D::ResetStats to the next
+struct RendererStats {
+    uint32_t DrawCalls = 0;
+    uint32_t QuadCount = 0;
+    uint32_t VertexCount = 0; // vertices the draws run through: 4 per batched quad, 6 per instance
+    uint32_t CulledCount = 0; // quads rejected by view culling before any vertex work
+    uint64_t BytesUploaded = 0; // vertex and instance data written for the GPU, streamed and static
+    uint32_t TextureBinds = 0;
+    uint32_t UniqueTextures = 0; // distinct textures (arrays in TextureMode::Arrays) bound
+    float FenceWaitTime = 0.0f; // ms spent waiting for the GPU to release stream buffer regions
+    uint32_t BatchBreaks[static_cast<size_t>(BatchBreak::Count)] = {}; // indexed by BatchBreak
+
+    // GPU time of the newest scene the GPU has finished, one or more scenes old; filled in at
+    // BeginScene when the device has timer queries
+    float GPUSceneTime = 0.0f;    // ms
+    float GPUBatchTime = 0.0f;    // ms, summed over its batches
+    float GPUBatchTimeMax = 0.0f; // ms, its slowest batch
+    uint32_t GPUTimedBatches = 0;
+
+    float Get(RendererCounter counter) const;
+};
+
+struct RendererCounterSummary {
+    float Min = 0.0f;
+    float Avg = 0.0f;
+    float P99 = 0.0f;
+    float Max = 0.0f;
+};
+
+// The last `frames` RendererStats, summarized per counter on request. Pushing a frame copies a
+// few dozen floats; the sorting happens in Summarize.
+class RendererStatsHistory {
+public:
+    explicit RendererStatsHistory(uint32_t frames = 240);
+
+    void Push(const RendererStats& stats);
+    void Clear();
+
+    // Drops the stored frames
+    void SetCapacity(uint32_t frames);
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(m_Frames.size()); }
+    uint32_t GetFrameCount() const { return m_Count; }
+
+    // Over the stored frames, all zero when there are none. P99 is the nearest-rank percentile.
+    RendererCounterSummary Summarize(RendererCounter counter) const;
+
+    // One line per counter with min / avg / p99 / max, for logging
+    std::string ToString() const;
+
+private:
+    using Frame = std::array<float, static_cast<size_t>(RendererCounter::Count)>;
+
+    std::vector<Frame> m_Frames;
+    uint32_t m_Next = 0;
+    uint32_t m_Count = 0;
+    mutable std::vector<float> m_Scratch;
+};
+
+}
@@ -1,6 +1,7 @@
 #include "Shader.h"
 #include "RendererAPI.h"
 #include "Platform/OpenGL/OpenGLShader.h" //Platform specific
+#include "Platform/Capture/CaptureShader.h"
 
 #include <iostream>
 
@@ -13,6 +14,8 @@ std::shared_ptr<Shader> Shader::Create(const std::string& vertexPath, const std:
             return nullptr;
         case RendererAPI::API::OpenGL:  
             return std::make_shared<OpenGLShader>(vertexPath, fragmentPath);
+        case RendererAPI::API::Capture:
+            return std::make_shared<CaptureShader>(vertexPath, fragmentPath);
     }
 
     std::cerr << "Unknown RendererAPI!" << std::endl;
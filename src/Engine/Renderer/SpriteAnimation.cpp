@@ -0,0 +1,234 @@
+#include "Engine/Renderer/SpriteAnimation.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+// Wraps or clamps a phase, in frames, and picks its frame. Update runs the same steps
+// ENG_SIMD_WIDTH instances at a time.
+static inline float Advance(float phase, float period, float invPeriod, float length, uint32_t firstFrame,
+                            uint32_t& frame) {
+    // Wrap into [0, period). Floor by truncation, which SSE2 has; Once has invPeriod 0 and stays put.
+    const float turns = phase * invPeriod;
+    float whole = static_cast<float>(static_cast<int32_t>(turns));
+    whole -= turns < whole ? 1.0f : 0.0f;
+    phase -= period * whole;
+
+    // Once clamps to [0, n], the others only absorb rounding at the period end
+    const float limit = period > 0.0f ? period : length;
+    phase = std::min(std::max(phase, 0.0f), limit);
+
+    // Past the last frame: PingPong mirrors back, Once (and Loop, by rounding) holds frame n - 1
+    const float reflect = period > length ? period : 2.0f * length - 1.0f;
+    const float local = phase < length ? phase : reflect - phase;
+    frame = firstFrame + static_cast<uint32_t>(std::min(static_cast<int32_t>(local), static_cast<int32_t>(length) - 1));
+    return phase;
+}
+
+SpriteAnimation::ClipID SpriteAnimation::AddClip(TextureHandle texture, float frameRate) {
+    m_ClipTable.push_back({static_cast<uint32_t>(m_FrameRects.size() / 2), 0, std::max(frameRate, 0.0f), texture});
+    return static_cast<ClipID>(m_ClipTable.size() - 1);
+}
+
+void SpriteAnimation::AddFrame(const Vec2& min, const Vec2& max) {
+    m_FrameRects.push_back(Math::PackUnorm2x16(min));
+    m_FrameRects.push_back(Math::PackUnorm2x16(max));
+    m_ClipTable.back().FrameCount++;
+}
+
+SpriteAnimation::ClipID SpriteAnimation::AddClip(const std::shared_ptr<Texture2D>& sheet, const Vec2& cellSize,
+                                                 const Vec2& first, uint32_t frameCount, float frameRate) {
+    ClipID clip = AddClip(sheet->GetHandle(), frameRate);
+    m_Sheets.push_back(sheet);
+
+    const Vec2 uvCell = cellSize / Vec2(static_cast<float>(sheet->GetWidth()), static_cast<float>(sheet->GetHeight()));
+    const uint32_t columns = std::max(static_cast<uint32_t>(sheet->GetWidth() / cellSize.x), 1u);
+    Vec2 cell = first;
+    for (uint32_t i = 0; i < frameCount; i++) {
+        AddFrame(cell * uvCell, (cell + Vec2(1.0f)) * uvCell);
+        cell.x += 1.0f;
+        if (cell.x >= static_cast<float>(columns)) {
+            cell.x = 0.0f;
+            cell.y -= 1.0f;
+        }
+    }
+    if (frameCount == 0) {
+        ENG_CORE_WARN("SpriteAnimation: clip {0} has no frames, it draws the whole sheet", clip);
+        AddFrame(Vec2(0.0f), Vec2(1.0f));
+    }
+    return clip;
+}
+
+SpriteAnimation::ClipID SpriteAnimation::AddClip(const std::vector<std::shared_ptr<SubTexture2D>>& frames,
+                                                 float frameRate) {
+    const std::shared_ptr<Texture2D> texture = frames.empty() ? nullptr : frames[0]->GetTexture();
+    ClipID clip = AddClip(texture ? texture->GetHandle() : TextureHandle(), frameRate);
+    if (texture) m_Sheets.push_back(texture);
+
+    for (const auto& frame : frames) {
+        if (frame->GetTexture() != texture) {
+            ENG_CORE_WARN("SpriteAnimation: clip {0} frames must share one texture, frame {1} does not", clip,
+                          m_ClipTable.back().FrameCount);
+        }
+        const Vec2* coords = frame->GetTexCoords();
+        AddFrame(coords[0], coords[2]);
+    }
+    if (frames.empty()) {
+        ENG_CORE_WARN("SpriteAnimation: clip {0} has no frames", clip);
+        AddFrame(Vec2(0.0f), Vec2(1.0f));
+    }
+    return clip;
+}
+
+float SpriteAnimation::GetClipDuration(ClipID clip) const {
+    const Clip& data = m_ClipTable[clip];
+    return data.FrameRate > 0.0f ? data.FrameCount / data.FrameRate : 0.0f;
+}
+
+uint32_t SpriteAnimation::Insert(ClipID clip, AnimationLoop loop, float speed, float time) {
+    const uint32_t instance = static_cast<uint32_t>(m_Phases.size());
+    m_Phases.push_back(0.0f);
+    m_Steps.push_back(0.0f);
+    m_Periods.push_back(0.0f);
+    m_InvPeriods.push_back(0.0f);
+    m_Lengths.push_back(0.0f);
+    m_FirstFrames.push_back(0);
+    m_Frames.push_back(0);
+    m_Clips.push_back(clip);
+    m_Speeds.push_back(speed);
+    m_Loops.push_back(loop);
+    m_Textures.push_back(TextureHandle());
+    Configure(instance, time);
+    return instance;
+}
+
+void SpriteAnimation::Remove(uint32_t instance) {
+    auto swapRemove = [instance](auto& values) {
+        values[instance] = values.back();
+        values.pop_back();
+    };
+    swapRemove(m_Phases);
+    swapRemove(m_Steps);
+    swapRemove(m_Periods);
+    swapRemove(m_InvPeriods);
+    swapRemove(m_Lengths);
+    swapRemove(m_FirstFrames);
+    swapRemove(m_Frames);
+    swapRemove(m_Clips);
+    swapRemove(m_Speeds);
+    swapRemove(m_Loops);
+    swapRemove(m_Textures);
+}
+
+void SpriteAnimation::Clear() {
+    m_Phases.clear();
+    m_Steps.clear();
+    m_Periods.clear();
+    m_InvPeriods.clear();
+    m_Lengths.clear();
+    m_FirstFrames.clear();
+    m_Frames.clear();
+    m_Clips.clear();
+    m_Speeds.clear();
+    m_Loops.clear();
+    m_Textures.clear();
+}
+
+void SpriteAnimation::Play(uint32_t instance, ClipID clip, AnimationLoop loop, float speed, float time) {
+    m_Clips[instance] = clip;
+    m_Loops[instance] = loop;
+    m_Speeds[instance] = speed;
+    Configure(instance, time);
+}
+
+void SpriteAnimation::SetSpeed(uint32_t instance, float speed) {
+    m_Speeds[instance] = speed;
+    m_Steps[instance] = m_ClipTable[m_Clips[instance]].FrameRate * speed;
+}
+
+void SpriteAnimation::SetTime(uint32_t instance, float time) { Configure(instance, time); }
+
+float SpriteAnimation::GetTime(uint32_t instance) const {
+    const float frameRate = m_ClipTable[m_Clips[instance]].FrameRate;
+    return frameRate > 0.0f ? m_Phases[instance] / frameRate : 0.0f;
+}
+
+bool SpriteAnimation::IsFinished(uint32_t instance) const {
+    if (m_Loops[instance] != AnimationLoop::Once) return false;
+    return m_Steps[instance] >= 0.0f ? m_Phases[instance] >= m_Lengths[instance] : m_Phases[instance] <= 0.0f;
+}
+
+void SpriteAnimation::Configure(uint32_t instance, float time) {
+    const Clip& clip = m_ClipTable[m_Clips[instance]];
+    const float length = static_cast<float>(clip.FrameCount);
+    float period = length;
+    if (m_Loops[instance] == AnimationLoop::Once) period = 0.0f;
+    // Two frames bounce the same as they loop, and the mirror below needs 2n - 2 > n
+    else if (m_Loops[instance] == AnimationLoop::PingPong && clip.FrameCount > 2) period = 2.0f * length - 2.0f;
+
+    m_Steps[instance] = clip.FrameRate * m_Speeds[instance];
+    m_Periods[instance] = period;
+    m_InvPeriods[instance] = period > 0.0f ? 1.0f / period : 0.0f;
+    m_Lengths[instance] = length;
+    m_FirstFrames[instance] = clip.FirstFrame;
+    m_Textures[instance] = clip.Texture;
+
+    m_Phases[instance] = Advance(time * clip.FrameRate, period, m_InvPeriods[instance], length,
+                                 clip.FirstFrame, m_Frames[instance]);
+}
+
+void SpriteAnimation::Update(Timestep ts) {
+    const float dt = ts.GetSeconds();
+    const size_t count = m_Phases.size();
+    float* phases = m_Phases.data();
+    const float* steps = m_Steps.data();
+    const float* periods = m_Periods.data();
+    const float* invPeriods = m_InvPeriods.data();
+    const float* lengths = m_Lengths.data();
+    const uint32_t* firstFrames = m_FirstFrames.data();
+    uint32_t* frames = m_Frames.data();
+
+    size_t i = 0;
+
+#if ENG_SIMD_WIDTH > 1
+    using namespace SIMD;
+    const Lane step = Splat(dt), zero = Splat(0.0f), one = Splat(1.0f), two = Splat(2.0f);
+    alignas(32) int32_t local[LANES];
+    for (; i + LANES <= count; i += LANES) {
+        const Lane length = Load(lengths + i);
+        const Lane period = Load(periods + i);
+        Lane phase = Add(Load(phases + i), Mul(Load(steps + i), step));
+
+        const Lane turns = Mul(phase, Load(invPeriods + i));
+        Lane whole = Truncate(turns);
+        whole = Select(Less(turns, whole), Sub(whole, one), whole);
+        phase = Sub(phase, Mul(period, whole));
+
+        const Lane limit = Select(Less(zero, period), period, length);
+        phase = Min(Max(phase, zero), limit);
+        Store(phases + i, phase);
+
+        const Lane reflect = Select(Less(length, period), period, Sub(Mul(two, length), one));
+        const Lane frame = Select(Less(phase, length), phase, Sub(reflect, phase));
+        StoreInt(local, Min(frame, Sub(length, one)));
+        for (size_t l = 0; l < LANES; l++) frames[i + l] = firstFrames[i + l] + static_cast<uint32_t>(local[l]);
+    }
+#endif
+
+    // Scalar tail (or every instance on builds without SIMD)
+    for (; i < count; i++) {
+        phases[i] = Advance(phases[i] + steps[i] * dt, periods[i], invPeriods[i], lengths[i], firstFrames[i],
+                            frames[i]);
+    }
+}
+
+void SpriteAnimation::FillSpan(QuadSpan& span) const {
+    span.Frames = m_Frames.data();
+    span.FrameRects = m_FrameRects.data();
+    span.Textures = m_Textures.data();
+}
+
+}
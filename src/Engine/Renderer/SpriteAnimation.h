@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+#include "Engine/Core/Timestep.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Renderer/TextureRegistry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+struct QuadSpan;
+
+enum class AnimationLoop : uint8_t {
+    Once = 0, // stops on the last frame
+    Loop,
+    PingPong, // forward, then back, without repeating the end frames
+};
+
+// Flipbook playback for many sprites at once. Clips are runs in one flat table of packed UV
+// rects; instances keep their playback state structure-of-arrays and Update advances all of them
+// in a single branch-free loop. The result is a frame index per instance, handed to
+// Renderer2D::DrawQuads through FillSpan, so nothing is allocated or swapped per frame.
+//
+// Instance indices are dense: Remove moves the last instance into the hole, so keep the arrays
+// holding the sprites' positions in the same order.
+class SpriteAnimation {
+public:
+    using ClipID = uint32_t;
+
+    // `frameCount` cells of a uniform grid, left to right from `first` and then down a row.
+    // Cells are in SubTexture2D::CreateFromCoords units.
+    ClipID AddClip(const std::shared_ptr<Texture2D>& sheet, const Vec2& cellSize, const Vec2& first,
+                   uint32_t frameCount, float frameRate);
+    // The frames must share one texture, e.g. regions of one atlas page
+    ClipID AddClip(const std::vector<std::shared_ptr<SubTexture2D>>& frames, float frameRate);
+
+    uint32_t GetClipCount() const { return static_cast<uint32_t>(m_ClipTable.size()); }
+    // Seconds for one pass through the frames
+    float GetClipDuration(ClipID clip) const;
+
+    // Returns the new instance's index
+    uint32_t Insert(ClipID clip, AnimationLoop loop = AnimationLoop::Loop, float speed = 1.0f, float time = 0.0f);
+    void Remove(uint32_t instance);
+    // Removes every instance, the clips stay
+    void Clear();
+
+    // Switches clip and restarts at `time` seconds
+    void Play(uint32_t instance, ClipID clip, AnimationLoop loop = AnimationLoop::Loop, float speed = 1.0f,
+              float time = 0.0f);
+    // Negative speeds play backwards
+    void SetSpeed(uint32_t instance, float speed);
+    void SetTime(uint32_t instance, float time);
+
+    ClipID GetClip(uint32_t instance) const { return m_Clips[instance]; }
+    float GetSpeed(uint32_t instance) const { return m_Speeds[instance]; }
+    // Seconds into the clip, wrapped for looping instances
+    float GetTime(uint32_t instance) const;
+    // Once instances that played past their last frame (or their first, playing backwards)
+    bool IsFinished(uint32_t instance) const;
+
+    // Advances every instance and recomputes its frame
+    void Update(Timestep ts);
+
+    size_t GetCount() const { return m_Phases.size(); }
+    // Per instance, index of the current rect in GetFrameRects
+    const uint32_t* GetFrames() const { return m_Frames.data(); }
+    // Two words per rect, min and max corner, unorm16 packed
+    const uint32_t* GetFrameRects() const { return m_FrameRects.data(); }
+    const TextureHandle* GetTextures() const { return m_Textures.data(); }
+
+    // Points the span's UV and texture arrays at the current frames. Count and positions are the
+    // caller's; span.Count must not exceed GetCount().
+    void FillSpan(QuadSpan& span) const;
+
+private:
+    struct Clip {
+        uint32_t FirstFrame;
+        uint32_t FrameCount;
+        float FrameRate;
+        TextureHandle Texture;
+    };
+
+    ClipID AddClip(TextureHandle texture, float frameRate);
+    void AddFrame(const Vec2& min, const Vec2& max);
+    // Refreshes the derived per-instance arrays after a clip, loop or speed change
+    void Configure(uint32_t instance, float time);
+
+    std::vector<Clip> m_ClipTable;
+    std::vector<uint32_t> m_FrameRects;
+    std::vector<std::shared_ptr<Texture2D>> m_Sheets; // keeps the clip textures alive
+
+    // Playback state, one entry per instance. Phase is in frames; Period is the frame count the
+    // phase wraps at (2n - 2 for PingPong) and 0 for Once, which clamps instead.
+    std::vector<float> m_Phases;
+    std::vector<float> m_Steps; // frames per second, frame rate times speed
+    std::vector<float> m_Periods;
+    std::vector<float> m_InvPeriods; // 0 for Once
+    std::vector<float> m_Lengths;    // frame count of the clip
+    std::vector<uint32_t> m_FirstFrames;
+    std::vector<uint32_t> m_Frames;  // output of Update
+
+    // Cold: only read when an instance is reconfigured
+    std::vector<ClipID> m_Clips;
+    std::vector<float> m_Speeds;
+    std::vector<AnimationLoop> m_Loops;
+    std::vector<TextureHandle> m_Textures;
+};
+
+}
@@ -0,0 +1,188 @@
+#include "Engine/Renderer/SpriteGrid.h"
+
+#include <cmath>
+
+namespace Engine {
+
+// Half the diagonal: an upper bound on the extent of the sprite at any rotation
+static float BoundingRadius(const Vec2& size) {
+    return 0.5f * std::sqrt(size.x * size.x + size.y * size.y);
+}
+
+static uint64_t PackCell(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+SpriteGrid::SpriteGrid(float cellSize) : m_CellSize(cellSize), m_InvCellSize(1.0f / cellSize) {}
+
+uint64_t SpriteGrid::CellKey(const Vec3& position) const {
+    return PackCell(static_cast<int32_t>(std::floor(position.x * m_InvCellSize)),
+                    static_cast<int32_t>(std::floor(position.y * m_InvCellSize)));
+}
+
+std::vector<uint32_t>& SpriteGrid::CellList(const Location& location) {
+    return location.Large ? m_Large : m_Cells[location.Cell];
+}
+
+void SpriteGrid::Place(SpriteID id) {
+    Location& location = m_Locations[id];
+    // Within one cell of slack the widened query still finds it
+    location.Large = BoundingRadius(m_Sizes[location.Dense]) > m_CellSize;
+    location.Cell = location.Large ? 0 : CellKey(m_Positions[location.Dense]);
+
+    std::vector<uint32_t>& list = CellList(location);
+    location.Slot = static_cast<uint32_t>(list.size());
+    list.push_back(location.Dense);
+}
+
+void SpriteGrid::Unplace(SpriteID id) {
+    const Location& location = m_Locations[id];
+    std::vector<uint32_t>& list = CellList(location);
+
+    uint32_t moved = list.back();
+    list[location.Slot] = moved;
+    m_Locations[m_DenseToID[moved]].Slot = location.Slot;
+    list.pop_back();
+    if (list.empty() && !location.Large) m_Cells.erase(location.Cell);
+}
+
+SpriteGrid::SpriteID SpriteGrid::Insert(const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                                        TextureHandle texture) {
+    SpriteID id;
+    if (!m_FreeIDs.empty()) {
+        id = m_FreeIDs.back();
+        m_FreeIDs.pop_back();
+    } else {
+        id = static_cast<SpriteID>(m_Locations.size());
+        m_Locations.emplace_back();
+    }
+
+    m_Locations[id].Dense = static_cast<uint32_t>(m_Positions.size());
+    m_Positions.push_back(position);
+    m_Sizes.push_back(size);
+    m_Rotations.push_back(rotation);
+    m_Colors.push_back(color);
+    m_Textures.push_back(texture);
+    m_DenseToID.push_back(id);
+
+    Place(id);
+    return id;
+}
+
+void SpriteGrid::Move(SpriteID id, const Vec3& position) {
+    if (!Contains(id)) return;
+    Location& location = m_Locations[id];
+    m_Positions[location.Dense] = position;
+
+    // Most moves stay inside the cell
+    if (location.Large || CellKey(position) == location.Cell) return;
+    Unplace(id);
+    Place(id);
+}
+
+void SpriteGrid::Update(SpriteID id, const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                        TextureHandle texture) {
+    if (!Contains(id)) return;
+    uint32_t dense = m_Locations[id].Dense;
+    Unplace(id);
+    m_Positions[dense] = position;
+    m_Sizes[dense] = size;
+    m_Rotations[dense] = rotation;
+    m_Colors[dense] = color;
+    m_Textures[dense] = texture;
+    Place(id);
+}
+
+void SpriteGrid::Remove(SpriteID id) {
+    if (!Contains(id)) return;
+    Unplace(id);
+
+    // Fill the hole with the last sprite and repoint its cell entry
+    uint32_t dense = m_Locations[id].Dense;
+    uint32_t last = static_cast<uint32_t>(m_Positions.size() - 1);
+    if (dense != last) {
+        SpriteID lastID = m_DenseToID[last];
+        m_Positions[dense] = m_Positions[last];
+        m_Sizes[dense] = m_Sizes[last];
+        m_Rotations[dense] = m_Rotations[last];
+        m_Colors[dense] = m_Colors[last];
+        m_Textures[dense] = m_Textures[last];
+        m_DenseToID[dense] = lastID;
+
+        Location& moved = m_Locations[lastID];
+        moved.Dense = dense;
+        CellList(moved)[moved.Slot] = dense;
+    }
+    m_Positions.pop_back();
+    m_Sizes.pop_back();
+    m_Rotations.pop_back();
+    m_Colors.pop_back();
+    m_Textures.pop_back();
+    m_DenseToID.pop_back();
+
+    m_Locations[id] = Location();
+    m_FreeIDs.push_back(id);
+}
+
+void SpriteGrid::Clear() {
+    m_Positions.clear();
+    m_Sizes.clear();
+    m_Rotations.clear();
+    m_Colors.clear();
+    m_Textures.clear();
+    m_DenseToID.clear();
+    m_Locations.clear();
+    m_FreeIDs.clear();
+    m_Cells.clear();
+    m_Large.clear();
+}
+
+bool SpriteGrid::Contains(SpriteID id) const {
+    return id < m_Locations.size() && m_Locations[id].Dense != INVALID;
+}
+
+void SpriteGrid::QueryCandidates(const Vec2& min, const Vec2& max, std::vector<uint32_t>& out) const {
+    // One cell of slack for sprites that reach out of their cell
+    const int32_t x0 = static_cast<int32_t>(std::floor(min.x * m_InvCellSize)) - 1;
+    const int32_t y0 = static_cast<int32_t>(std::floor(min.y * m_InvCellSize)) - 1;
+    const int32_t x1 = static_cast<int32_t>(std::floor(max.x * m_InvCellSize)) + 1;
+    const int32_t y1 = static_cast<int32_t>(std::floor(max.y * m_InvCellSize)) + 1;
+
+    const double rangeCells = (static_cast<double>(x1) - x0 + 1) * (static_cast<double>(y1) - y0 + 1);
+    if (rangeCells > static_cast<double>(m_Cells.size())) {
+        // Zoomed far out: walking the occupied cells is cheaper than probing the whole range
+        for (const auto& [key, list] : m_Cells) {
+            int32_t x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+            int32_t y = static_cast<int32_t>(static_cast<uint32_t>(key));
+            if (x < x0 || x > x1 || y < y0 || y > y1) continue;
+            out.insert(out.end(), list.begin(), list.end());
+        }
+    } else {
+        for (int32_t y = y0; y <= y1; y++) {
+            for (int32_t x = x0; x <= x1; x++) {
+                auto it = m_Cells.find(PackCell(x, y));
+                if (it != m_Cells.end()) out.insert(out.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    out.insert(out.end(), m_Large.begin(), m_Large.end());
+}
+
+void SpriteGrid::Query(const Vec2& min, const Vec2& max, std::vector<SpriteID>& out) const {
+    std::vector<uint32_t> candidates;
+    QueryCandidates(min, max, candidates);
+    for (uint32_t dense : candidates) {
+        const Vec3& position = m_Positions[dense];
+        const Vec2& size = m_Sizes[dense];
+        // Axis-aligned extent of the rotated rectangle
+        float c = std::abs(std::cos(m_Rotations[dense]));
+        float s = std::abs(std::sin(m_Rotations[dense]));
+        float extentX = 0.5f * (size.x * c + size.y * s);
+        float extentY = 0.5f * (size.x * s + size.y * c);
+        if (position.x + extentX < min.x || position.x - extentX > max.x) continue;
+        if (position.y + extentY < min.y || position.y - extentY > max.y) continue;
+        out.push_back(m_DenseToID[dense]);
+    }
+}
+
+}
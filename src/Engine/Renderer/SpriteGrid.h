@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Engine/Renderer/TextureRegistry.h"
+#include "Engine/Core/Math.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+// Loose uniform grid owning sprites that rarely move, drawn with Renderer2D::DrawSpriteGrid.
+// A sprite lives in the cell holding its center. Queries widen their rectangle by one cell, so
+// sprites up to a cell across are never missed; larger sprites sit in a separate list that every
+// query returns. Cells are hashed: the world is unbounded and empty space costs nothing.
+// Query and draw cost follow the number of cells and sprites in view, not the sprite count.
+//
+// Sprites are stored structure-of-arrays and drawn through the DrawQuads path. Draw order
+// follows the cells; give overlapping sprites distinct depths or use deferred submission.
+class SpriteGrid {
+public:
+    // Stable for the life of the sprite; reused after Remove
+    using SpriteID = uint32_t;
+
+    // Pick a cell about the size of a typical sprite, a few cells per screen
+    explicit SpriteGrid(float cellSize = 1.0f);
+
+    SpriteID Insert(const Vec3& position, const Vec2& size, float rotation = 0.0f, const Vec4& color = Vec4(1.0f),
+                    TextureHandle texture = TextureHandle());
+    void Move(SpriteID id, const Vec3& position);
+    void Update(SpriteID id, const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                TextureHandle texture = TextureHandle());
+    void Remove(SpriteID id);
+    void Clear();
+
+    bool Contains(SpriteID id) const;
+    size_t GetCount() const { return m_Positions.size(); }
+    float GetCellSize() const { return m_CellSize; }
+
+    // Appends the sprites whose rotated bounds overlap [min, max]
+    void Query(const Vec2& min, const Vec2& max, std::vector<SpriteID>& out) const;
+
+private:
+    friend class Renderer2D;
+
+    static constexpr uint32_t INVALID = ~0u;
+
+    struct Location {
+        uint32_t Dense = INVALID; // index into the sprite arrays, INVALID for a free id
+        uint64_t Cell = 0;
+        uint32_t Slot = 0;        // index in the cell's list
+        bool Large = false;       // in m_Large instead of a cell
+    };
+
+    // Appends the dense index of every sprite in a cell that may overlap [min, max]; no per-sprite test
+    void QueryCandidates(const Vec2& min, const Vec2& max, std::vector<uint32_t>& out) const;
+
+    uint64_t CellKey(const Vec3& position) const;
+    std::vector<uint32_t>& CellList(const Location& location);
+    // Files the sprite under its cell (or the large list) and records where
+    void Place(SpriteID id);
+    void Unplace(SpriteID id);
+
+    float m_CellSize;
+    float m_InvCellSize;
+
+    // Dense sprite data, swap-removed
+    std::vector<Vec3> m_Positions;
+    std::vector<Vec2> m_Sizes;
+    std::vector<float> m_Rotations;
+    std::vector<Vec4> m_Colors;
+    std::vector<TextureHandle> m_Textures;
+    std::vector<SpriteID> m_DenseToID;
+
+    std::vector<Location> m_Locations; // indexed by SpriteID
+    std::vector<SpriteID> m_FreeIDs;
+
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells; // dense indices per cell
+    std::vector<uint32_t> m_Large;
+};
+
+}
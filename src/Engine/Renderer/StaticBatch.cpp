@@ -0,0 +1,135 @@
+#include "Engine/Renderer/StaticBatch.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/VertexArray.h"
+#include "Engine/Core/Log.h"
+
+namespace Engine {
+
+float StaticBatch::TextureSlot(TextureHandle texture) {
+    if (!texture.IsValid()) return 0.0f;
+
+    // In TextureMode::Arrays the batch binds whole arrays and addresses their layers
+    uint32_t layer = 0;
+    uint32_t shift = 0;
+    if (Renderer2D::GetTextureMode() == TextureMode::Arrays) {
+        Texture* resolved = TextureRegistry::Get(texture);
+        Texture2DArray* array = resolved ? resolved->GetArray() : nullptr;
+        if (!array) return 0.0f;
+        texture = array->GetHandle();
+        layer = resolved->GetArrayLayer();
+        shift = Renderer2D::ARRAY_LAYER_BITS;
+    }
+
+    for (size_t i = 0; i < m_Textures.size(); i++) {
+        if (m_Textures[i] == texture) return static_cast<float>(((i + 1) << shift) | layer);
+    }
+    if (m_Textures.size() + 1 >= Renderer2D::MAX_TEXTURE_SLOTS) {
+        if (!m_WarnedTextures) {
+            ENG_CORE_WARN("StaticBatch: more than {0} textures, extra ones are drawn white",
+                          Renderer2D::MAX_TEXTURE_SLOTS - 1);
+            m_WarnedTextures = true;
+        }
+        return 0.0f;
+    }
+    m_Textures.push_back(texture);
+    return static_cast<float>((m_Textures.size() << shift) | layer);
+}
+
+void StaticBatch::Touch(uint32_t first, uint32_t count) {
+    if (count == 0) return;
+
+    if (m_DirtyBegin == m_DirtyEnd) {
+        m_DirtyBegin = first;
+        m_DirtyEnd = first + count;
+    } else {
+        m_DirtyBegin = std::min(m_DirtyBegin, first);
+        m_DirtyEnd = std::max(m_DirtyEnd, first + count);
+    }
+
+    const QuadVertex* vertex = m_Vertices.data() + static_cast<size_t>(first) * 4;
+    for (size_t i = 0; i < static_cast<size_t>(count) * 4; i++, vertex++) {
+        m_BoundsMin.x = std::min(m_BoundsMin.x, vertex->Position.x);
+        m_BoundsMin.y = std::min(m_BoundsMin.y, vertex->Position.y);
+        m_BoundsMax.x = std::max(m_BoundsMax.x, vertex->Position.x);
+        m_BoundsMax.y = std::max(m_BoundsMax.y, vertex->Position.y);
+    }
+}
+
+uint32_t StaticBatch::AddQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                              TextureHandle texture, float tilingFactor) {
+    uint32_t index = GetQuadCount();
+    m_Vertices.resize(m_Vertices.size() + 4);
+    UpdateQuad(index, position, size, rotation, color, texture, tilingFactor);
+    return index;
+}
+
+uint32_t StaticBatch::AddQuads(const QuadSpan& quads) {
+    uint32_t first = GetQuadCount();
+
+    QuadKernelInput input;
+    input.Positions = quads.Positions;
+    input.Sizes = quads.Sizes;
+    input.Rotations = quads.Rotations;
+    input.Colors = quads.Colors;
+    input.Color = quads.Color;
+    input.TilingFactor = quads.TilingFactor;
+    input.Frames = quads.Frames;
+    input.FrameRects = quads.FrameRects;
+    if (quads.Textures) {
+        m_TexIndices.resize(quads.Count);
+        for (size_t i = 0; i < quads.Count; i++) {
+            m_TexIndices[i] = TextureSlot(quads.Textures[i]);
+        }
+        input.TexIndices = m_TexIndices.data();
+    } else {
+        input.TexIndex = TextureSlot(quads.Texture);
+    }
+
+    m_Vertices.resize(m_Vertices.size() + quads.Count * 4);
+    QuadKernels::EmitQuads(input, 0, quads.Count, m_Vertices.data() + static_cast<size_t>(first) * 4);
+    Touch(first, static_cast<uint32_t>(quads.Count));
+    return first;
+}
+
+void StaticBatch::UpdateQuad(uint32_t index, const Vec3& position, const Vec2& size, float rotation,
+                             const Vec4& color, TextureHandle texture, float tilingFactor) {
+    if (index >= GetQuadCount()) return;
+
+    QuadKernels::EmitQuad(m_Vertices.data() + static_cast<size_t>(index) * 4, position, size, rotation, color,
+                          TextureSlot(texture), tilingFactor, QuadKernels::DefaultTexCoords);
+    Touch(index, 1);
+}
+
+void StaticBatch::Clear() {
+    m_Vertices.clear();
+    m_Textures.clear();
+    m_DirtyBegin = m_DirtyEnd = 0;
+    m_BoundsMin = Vec2(FLT_MAX);
+    m_BoundsMax = Vec2(-FLT_MAX);
+    m_WarnedTextures = false;
+}
+
+uint32_t StaticBatch::Upload() {
+    uint32_t count = GetQuadCount();
+    if (count > m_Capacity) {
+        // Grow geometrically so a batch that keeps getting quads appended is not recreated every frame
+        m_Capacity = std::max(count, m_Capacity * 2);
+        m_VertexBuffer = VertexBuffer::Create(m_Capacity * 4 * sizeof(QuadVertex));
+        m_VertexBuffer->SetLayout(Renderer2D::GetQuadVertexLayout());
+        m_VertexArray = VertexArray::Create();
+        m_VertexArray->AddVertexBuffer(m_VertexBuffer);
+        m_VertexArray->SetIndexBuffer(Renderer2D::GetQuadIndexBuffer());
+        m_DirtyBegin = 0;
+        m_DirtyEnd = count;
+    }
+    if (m_DirtyBegin == m_DirtyEnd) return 0;
+
+    const uint32_t quadSize = 4 * sizeof(QuadVertex);
+    const uint32_t size = (m_DirtyEnd - m_DirtyBegin) * quadSize;
+    m_VertexBuffer->SetData(m_Vertices.data() + static_cast<size_t>(m_DirtyBegin) * 4, size,
+                            m_DirtyBegin * quadSize);
+    m_DirtyBegin = m_DirtyEnd = 0;
+    return size;
+}
+
+}
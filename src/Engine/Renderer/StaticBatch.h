@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/TextureRegistry.h"
+#include "Engine/Core/Math.h"
+
+#include <cfloat>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+struct QuadSpan;
+class VertexArray;
+class VertexBuffer;
+
+// Quads recorded once into a GPU-resident vertex buffer and drawn every frame with a single
+// Renderer2D::DrawStaticBatch call, without per-frame transform, culling or upload.
+// A CPU copy is kept so individual quads can be changed with UpdateQuad; only the changed
+// range is re-uploaded at the next draw. Recording needs no GL context.
+//
+// A batch owns its texture set, at most Renderer2D::MAX_TEXTURE_SLOTS - 1 textures (texture
+// arrays in TextureMode::Arrays); quads beyond that fall back to white. Pack larger sets into
+// an atlas.
+class StaticBatch {
+public:
+    // Returns the index of the quad for later UpdateQuad calls
+    uint32_t AddQuad(const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                     TextureHandle texture = TextureHandle(), float tilingFactor = 1.0f);
+    // Returns the index of the first quad, the rest follow in span order
+    uint32_t AddQuads(const QuadSpan& quads);
+
+    void UpdateQuad(uint32_t index, const Vec3& position, const Vec2& size, float rotation, const Vec4& color,
+                    TextureHandle texture = TextureHandle(), float tilingFactor = 1.0f);
+
+    void Clear();
+
+    uint32_t GetQuadCount() const { return static_cast<uint32_t>(m_Vertices.size() / 4); }
+
+private:
+    friend class Renderer2D;
+
+    float TextureSlot(TextureHandle texture);
+    // Marks quads for upload and grows the bounds to cover them
+    void Touch(uint32_t first, uint32_t count);
+    // Creates or grows the GPU buffer if needed, otherwise uploads just the dirty range.
+    // Returns the bytes uploaded.
+    uint32_t Upload();
+
+    std::vector<QuadVertex> m_Vertices;
+    std::vector<TextureHandle> m_Textures; // bound at slot i + 1
+    std::vector<float> m_TexIndices;       // scratch for AddQuads
+
+    std::shared_ptr<VertexArray> m_VertexArray;
+    std::shared_ptr<VertexBuffer> m_VertexBuffer;
+    uint32_t m_Capacity = 0; // quads the GPU buffer can hold
+
+    // Quads [m_DirtyBegin, m_DirtyEnd) still need uploading
+    uint32_t m_DirtyBegin = 0;
+    uint32_t m_DirtyEnd = 0;
+
+    // Conservative world bounds for culling the whole batch; only ever grow
+    Vec2 m_BoundsMin = Vec2(FLT_MAX);
+    Vec2 m_BoundsMax = Vec2(-FLT_MAX);
+
+    bool m_WarnedTextures = false;
+};
+
+}
@@ -0,0 +1,139 @@
+#include "TextLayout.h"
+
+#include "Engine/Renderer/Font.h"
+
+#include "pch.h"
+
+#include <cfloat>
+#include <cstring>
+
+namespace Engine {
+
+// Reads one code point at `i` and moves past it; malformed sequences yield U+FFFD
+static uint32_t DecodeUTF8(std::string_view text, size_t& i) {
+    const uint8_t lead = static_cast<uint8_t>(text[i++]);
+    if (lead < 0x80) return lead;
+
+    const uint32_t count = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+    if (count == 0 || lead >= 0xF8) return 0xFFFD;
+    uint32_t codepoint = lead & (0x3F >> count);
+    for (uint32_t k = 0; k < count; k++) {
+        if (i >= text.size() || (static_cast<uint8_t>(text[i]) & 0xC0) != 0x80) return 0xFFFD;
+        codepoint = (codepoint << 6) | (static_cast<uint8_t>(text[i++]) & 0x3F);
+    }
+    return codepoint;
+}
+
+void TextLayout::Build(std::string_view text, const Font& font, float size) {
+    Glyphs.clear();
+    Min = Max = Vec2(0.0f);
+    Width = 0.0f;
+    LineCount = 1;
+
+    const bool kerning = font.HasKerning();
+    Vec2 min(FLT_MAX), max(-FLT_MAX);
+    float x = 0.0f, y = 0.0f;
+    uint32_t previous = 0;
+    for (size_t i = 0; i < text.size();) {
+        uint32_t codepoint = DecodeUTF8(text, i);
+        if (codepoint == '\n') {
+            Width = std::max(Width, x);
+            x = 0.0f;
+            y -= font.GetLineHeight() * size;
+            LineCount++;
+            previous = 0;
+            continue;
+        }
+        if (codepoint == '\r') continue;
+
+        const FontGlyph* glyph = font.GetGlyph(codepoint);
+        if (!glyph) {
+            glyph = &font.GetFallbackGlyph();
+            codepoint = glyph->Codepoint;
+        }
+        if (kerning && previous) x += font.GetKerning(previous, codepoint) * size;
+
+        if (!glyph->IsEmpty()) {
+            const Vec2 glyphMin = Vec2(x, y) + glyph->Min * size;
+            const Vec2 glyphMax = Vec2(x, y) + glyph->Max * size;
+            TextGlyph& quad = Glyphs.emplace_back();
+            quad.Center = (glyphMin + glyphMax) * 0.5f;
+            quad.Size = glyphMax - glyphMin;
+            quad.TexCoords[0] = glyph->UVMin;
+            quad.TexCoords[1] = {glyph->UVMax.x, glyph->UVMin.y};
+            quad.TexCoords[2] = glyph->UVMax;
+            quad.TexCoords[3] = {glyph->UVMin.x, glyph->UVMax.y};
+            min = glm::min(min, glyphMin);
+            max = glm::max(max, glyphMax);
+        }
+        x += glyph->Advance * size;
+        previous = codepoint;
+    }
+    Width = std::max(Width, x);
+    if (!Glyphs.empty()) {
+        Min = min;
+        Max = max;
+    }
+}
+
+TextLayoutCache::TextLayoutCache(size_t capacity) : m_Capacity(std::max<size_t>(capacity, 1)) {}
+
+const TextLayout& TextLayoutCache::Get(std::string_view text, const Font& font, float size) {
+    uint32_t sizeBits;
+    memcpy(&sizeBits, &size, sizeof(sizeBits));
+    const uint64_t params = (static_cast<uint64_t>(font.GetID()) << 32) | sizeBits;
+    uint64_t key = std::hash<std::string_view>{}(text);
+    key ^= params + 0x9E3779B97F4A7C15ull + (key << 6) + (key >> 2);
+
+    auto it = m_Entries.find(key);
+    if (it != m_Entries.end()) {
+        Entry& entry = it->second;
+        if (entry.FontID == font.GetID() && entry.Size == size && entry.Text == text) {
+            m_Hits++;
+            entry.LastUsed = ++m_Clock;
+            return entry.Layout;
+        }
+    }
+
+    m_Misses++;
+    if (it == m_Entries.end()) {
+        if (m_Entries.size() >= m_Capacity) Evict();
+        it = m_Entries.try_emplace(key).first;
+    }
+    Entry& entry = it->second;
+    entry.Text.assign(text);
+    entry.FontID = font.GetID();
+    entry.Size = size;
+    entry.LastUsed = ++m_Clock;
+    entry.Layout.Build(text, font, size);
+    return entry.Layout;
+}
+
+void TextLayoutCache::Clear() { m_Entries.clear(); }
+
+void TextLayoutCache::SetCapacity(size_t capacity) {
+    m_Capacity = std::max<size_t>(capacity, 1);
+    while (m_Entries.size() > m_Capacity) Evict();
+}
+
+void TextLayoutCache::Evict() {
+    if (m_Entries.size() < 2) {
+        m_Entries.clear();
+        return;
+    }
+
+    // Stamps are unique, so everything older than the median is exactly half
+    std::vector<uint64_t> stamps;
+    stamps.reserve(m_Entries.size());
+    for (const auto& [key, entry] : m_Entries) stamps.push_back(entry.LastUsed);
+    auto median = stamps.begin() + stamps.size() / 2;
+    std::nth_element(stamps.begin(), median, stamps.end());
+
+    const uint64_t cutoff = *median;
+    for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+        if (it->second.LastUsed < cutoff) it = m_Entries.erase(it);
+        else ++it;
+    }
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Engine/Core/Math.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+class Font;
+
+// One glyph quad, relative to the left end of the first baseline, in world units
+struct TextGlyph {
+    Vec2 Center;
+    Vec2 Size;
+    Vec2 TexCoords[4]; // corner order of QuadKernels::EmitQuad
+};
+
+// A string shaped with one font at one size: UTF-8 decoded, kerned, '\n' starts a new line.
+// Code points missing from the font draw its fallback glyph, spaces produce no quad.
+struct TextLayout {
+    std::vector<TextGlyph> Glyphs;
+    Vec2 Min = Vec2(0.0f); // bounds of the glyph quads
+    Vec2 Max = Vec2(0.0f);
+    float Width = 0.0f; // of the longest line, by advances
+    uint32_t LineCount = 0;
+
+    void Build(std::string_view text, const Font& font, float size);
+};
+
+// Layouts keyed by (text, font, size), so repeated labels are shaped once. A hit hashes the
+// string and allocates nothing. When full, the least recently used half is dropped.
+class TextLayoutCache {
+public:
+    explicit TextLayoutCache(size_t capacity = 4096);
+
+    // Valid until the next Get or Clear
+    const TextLayout& Get(std::string_view text, const Font& font, float size);
+
+    void Clear();
+    void SetCapacity(size_t capacity);
+    size_t GetSize() const { return m_Entries.size(); }
+    uint64_t GetHits() const { return m_Hits; }
+    uint64_t GetMisses() const { return m_Misses; }
+
+private:
+    struct Entry {
+        std::string Text;
+        uint32_t FontID;
+        float Size;
+        uint64_t LastUsed;
+        TextLayout Layout;
+    };
+
+    void Evict();
+
+    // Keyed by the hash alone; the entry keeps the full key, a collision just rebuilds it
+    std::unordered_map<uint64_t, Entry> m_Entries;
+    size_t m_Capacity;
+    uint64_t m_Clock = 0;
+    uint64_t m_Hits = 0;
+    uint64_t m_Misses = 0;
+};
+
+}
@@ -1,21 +1,42 @@
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Renderer/TextureArrayPool.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Capture/CaptureTexture.h"
 
 namespace Engine {
 
+Texture::Texture() : m_Handle(TextureRegistry::Register(this)) {}
+
+Texture::~Texture() { TextureRegistry::Unregister(m_Handle); }
+
 std::shared_ptr<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
+    if (TextureArrayPool::IsEnabled()) return TextureArrayPool::Allocate(width, height);
+
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTexture2D>(width, height);
+        case RendererAPI::API::Capture: return std::make_shared<CaptureTexture2D>(width, height);
     }
     return nullptr;
 }
 
 std::shared_ptr<Texture2D> Texture2D::Create(const std::string& path) {
+    if (TextureArrayPool::IsEnabled()) return TextureArrayPool::Load(path);
+
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTexture2D>(path);
+        case RendererAPI::API::Capture: return std::make_shared<CaptureTexture2D>(path);
+    }
+    return nullptr;
+}
+
+std::shared_ptr<Texture2DArray> Texture2DArray::Create(uint32_t width, uint32_t height, uint32_t layers) {
+    switch (RendererAPI::GetAPI()) {
+        case RendererAPI::API::None:    return nullptr;
+        case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTexture2DArray>(width, height, layers);
+        case RendererAPI::API::Capture: return std::make_shared<CaptureTexture2DArray>(width, height, layers);
     }
     return nullptr;
 }
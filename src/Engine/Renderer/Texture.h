@@ -1,29 +1,65 @@
 #pragma once
 
+#include "Engine/Renderer/TextureRegistry.h"
+
 #include <string>
 #include <memory>
 
 namespace Engine {
 
+class Texture2DArray;
+
 class Texture {
 public:
-    virtual ~Texture() = default;
+    virtual ~Texture();
+
+    Texture(const Texture&) = delete;
+    Texture& operator=(const Texture&) = delete;
+
+    // Stable for the lifetime of the texture, stale once it is destroyed
+    TextureHandle GetHandle() const { return m_Handle; }
 
     virtual uint32_t GetWidth() const = 0;
     virtual uint32_t GetHeight() const = 0;
     virtual uint32_t GetRendererID() const = 0;
 
     virtual void SetData(void* data, uint32_t size) = 0;
+    // Uploads a width x height block at (x, y), in the texture's own pixel format
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 
     virtual void Bind(uint32_t slot = 0) const = 0;
 
+    // Set for textures that live in one layer of a Texture2DArray (see TextureArrayPool).
+    // Bind() then binds the whole array and shaders sample GetArrayLayer().
+    virtual Texture2DArray* GetArray() const { return nullptr; }
+    virtual uint32_t GetArrayLayer() const { return 0; }
+
     virtual bool operator==(const Texture& other) const = 0;
+
+protected:
+    Texture();
+
+private:
+    TextureHandle m_Handle;
 };
 
 class Texture2D : public Texture {
 public:
+    // While the TextureArrayPool is enabled these allocate a layer of a pooled array instead of
+    // a texture object of their own; images are then always stored as RGBA8.
     static std::shared_ptr<Texture2D> Create(uint32_t width, uint32_t height);
     static std::shared_ptr<Texture2D> Create(const std::string& path);
 };
 
+// RGBA8 GL_TEXTURE_2D_ARRAY style texture: `layers` images of the same size behind one binding.
+// GetWidth/GetHeight are per layer, SetData fills every layer and SetSubData writes layer 0.
+class Texture2DArray : public Texture {
+public:
+    virtual uint32_t GetLayerCount() const = 0;
+    virtual void SetLayerData(uint32_t layer, const void* data, uint32_t x, uint32_t y, uint32_t width,
+                              uint32_t height) = 0;
+
+    static std::shared_ptr<Texture2DArray> Create(uint32_t width, uint32_t height, uint32_t layers);
+};
+
 }
\ No newline at end of file
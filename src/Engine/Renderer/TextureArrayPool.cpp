@@ -0,0 +1,140 @@
+#include "Engine/Renderer/TextureArrayPool.h"
+#include "Engine/Core/Log.h"
+#include "stb_image.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+static const uint32_t FIRST_ARRAY_LAYERS = 4;
+static const uint64_t FIRST_ARRAY_BUDGET = 16ull << 20; // bytes, keeps one-off large sizes cheap
+static const uint64_t ARRAY_BUDGET = 64ull << 20;
+
+struct PooledArray {
+    std::shared_ptr<Texture2DArray> Array;
+    std::vector<uint32_t> FreeLayers;
+};
+
+static bool s_Enabled = false;
+static uint32_t s_MaxLayers = 1;
+// Keyed by width << 32 | height
+static std::unordered_map<uint64_t, std::vector<PooledArray>> s_Arrays;
+
+static uint64_t MakeKey(uint32_t width, uint32_t height) {
+    return (static_cast<uint64_t>(width) << 32) | height;
+}
+
+static void ReleaseLayer(Texture2DArray* array, uint32_t layer) {
+    auto it = s_Arrays.find(MakeKey(array->GetWidth(), array->GetHeight()));
+    if (it == s_Arrays.end()) return;
+
+    for (PooledArray& pooled : it->second) {
+        if (pooled.Array.get() == array) {
+            pooled.FreeLayers.push_back(layer);
+            return;
+        }
+    }
+}
+
+// A Texture2D view of one layer; keeps its array alive and hands the layer back on destruction
+class TextureArrayLayer : public Texture2D {
+public:
+    TextureArrayLayer(const std::shared_ptr<Texture2DArray>& array, uint32_t layer) : m_Array(array), m_Layer(layer) {}
+    virtual ~TextureArrayLayer() { ReleaseLayer(m_Array.get(), m_Layer); }
+
+    virtual uint32_t GetWidth() const override { return m_Array->GetWidth(); }
+    virtual uint32_t GetHeight() const override { return m_Array->GetHeight(); }
+    virtual uint32_t GetRendererID() const override { return m_Array->GetRendererID(); }
+
+    virtual void SetData(void* data, uint32_t size) override {
+        if (size != GetWidth() * GetHeight() * 4) {
+            ENG_CORE_ERROR("Data size does not match texture size!");
+            return;
+        }
+        m_Array->SetLayerData(m_Layer, data, 0, 0, GetWidth(), GetHeight());
+    }
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override {
+        m_Array->SetLayerData(m_Layer, data, x, y, width, height);
+    }
+
+    virtual void Bind(uint32_t slot = 0) const override { m_Array->Bind(slot); }
+
+    virtual Texture2DArray* GetArray() const override { return m_Array.get(); }
+    virtual uint32_t GetArrayLayer() const override { return m_Layer; }
+
+    virtual bool operator==(const Texture& other) const override {
+        return other.GetArray() == m_Array.get() && other.GetArrayLayer() == m_Layer;
+    }
+
+private:
+    std::shared_ptr<Texture2DArray> m_Array;
+    uint32_t m_Layer;
+};
+
+void TextureArrayPool::Enable(uint32_t maxLayers) {
+    s_Enabled = true;
+    s_MaxLayers = std::max(maxLayers, 1u);
+}
+
+void TextureArrayPool::Disable() {
+    s_Enabled = false;
+    s_Arrays.clear();
+}
+
+bool TextureArrayPool::IsEnabled() { return s_Enabled; }
+
+std::shared_ptr<Texture2D> TextureArrayPool::Allocate(uint32_t width, uint32_t height) {
+    std::vector<PooledArray>& arrays = s_Arrays[MakeKey(width, height)];
+    for (PooledArray& pooled : arrays) {
+        if (pooled.FreeLayers.empty()) continue;
+
+        uint32_t layer = pooled.FreeLayers.back();
+        pooled.FreeLayers.pop_back();
+        return std::make_shared<TextureArrayLayer>(pooled.Array, layer);
+    }
+
+    uint64_t layerSize = static_cast<uint64_t>(width) * height * 4;
+    uint64_t budget = arrays.empty() ? FIRST_ARRAY_BUDGET : ARRAY_BUDGET;
+    uint64_t budgetLayers = std::max<uint64_t>(budget / std::max<uint64_t>(layerSize, 1), 1);
+    uint64_t layers = arrays.empty() ? FIRST_ARRAY_LAYERS : arrays.back().Array->GetLayerCount() * 2ull;
+    layers = std::min({layers, budgetLayers, static_cast<uint64_t>(s_MaxLayers)});
+
+    std::shared_ptr<Texture2DArray> array = Texture2DArray::Create(width, height, static_cast<uint32_t>(layers));
+    if (!array) return nullptr;
+
+    PooledArray pooled;
+    pooled.Array = array;
+    // Highest first, so layers are handed out in ascending order
+    for (uint32_t layer = static_cast<uint32_t>(layers) - 1; layer > 0; layer--) {
+        pooled.FreeLayers.push_back(layer);
+    }
+    arrays.push_back(std::move(pooled));
+    return std::make_shared<TextureArrayLayer>(array, 0);
+}
+
+std::shared_ptr<Texture2D> TextureArrayPool::Load(const std::string& path) {
+    int width, height, channels;
+    stbi_set_flip_vertically_on_load(1); // OpenGL Left Bottom Origin
+    stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+    if (!data) {
+        ENG_CORE_ERROR("Failed to load image: {0}", path);
+        return nullptr;
+    }
+
+    std::shared_ptr<Texture2D> texture = Allocate(width, height);
+    if (texture) texture->SetData(data, width * height * 4);
+    stbi_image_free(data);
+    return texture;
+}
+
+uint32_t TextureArrayPool::GetArrayCount() {
+    uint32_t count = 0;
+    for (const auto& [key, arrays] : s_Arrays) {
+        count += static_cast<uint32_t>(arrays.size());
+    }
+    return count;
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Engine/Renderer/Texture.h"
+
+#include <memory>
+#include <string>
+
+namespace Engine {
+
+// Groups same-size textures into shared RGBA8 Texture2DArray objects, so the renderer binds one
+// array for many textures and selects the image by layer. While the pool is enabled every
+// Texture2D::Create goes through it; Renderer2D enables it in TextureMode::Arrays.
+//
+// An array cannot grow in place, so the first array of a size gets a few layers (at most 16 MB)
+// and each further one twice as many as the last, up to the layer limit or 64 MB. Freed layers
+// are reused.
+class TextureArrayPool {
+public:
+    // maxLayers: per array, at most what the device supports
+    static void Enable(uint32_t maxLayers);
+    // Stops pooling and drops the pool's arrays; they stay alive while textures in them do
+    static void Disable();
+    static bool IsEnabled();
+
+    static std::shared_ptr<Texture2D> Allocate(uint32_t width, uint32_t height);
+    // nullptr if the image cannot be read
+    static std::shared_ptr<Texture2D> Load(const std::string& path);
+
+    static uint32_t GetArrayCount();
+};
+
+}
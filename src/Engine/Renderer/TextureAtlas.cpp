@@ -0,0 +1,247 @@
+#include "Engine/Renderer/TextureAtlas.h"
+#include "Engine/Core/Log.h"
+#include "stb_image.h"
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+
+namespace Engine {
+
+struct AtlasRect {
+    uint32_t X, Y, Width, Height;
+
+    bool Contains(const AtlasRect& other) const {
+        return other.X >= X && other.Y >= Y && other.X + other.Width <= X + Width &&
+               other.Y + other.Height <= Y + Height;
+    }
+    bool Intersects(const AtlasRect& other) const {
+        return other.X < X + Width && X < other.X + other.Width && other.Y < Y + Height &&
+               Y < other.Y + other.Height;
+    }
+};
+
+// MaxRects bin: the free list holds every maximal empty rectangle of the page, so any empty
+// area lies fully inside one of them. That makes both best-fit insertion and re-occupying a
+// cached rectangle a simple scan.
+struct TextureAtlas::Page {
+    std::vector<AtlasRect> FreeRects;
+
+    explicit Page(uint32_t size) { FreeRects.push_back({0, 0, size, size}); }
+
+    // Best short side fit
+    bool Insert(uint32_t width, uint32_t height, AtlasRect& out) {
+        uint32_t bestShort = UINT_MAX;
+        uint32_t bestLong = UINT_MAX;
+        const AtlasRect* best = nullptr;
+        for (const AtlasRect& rect : FreeRects) {
+            if (rect.Width < width || rect.Height < height) continue;
+
+            uint32_t leftoverX = rect.Width - width;
+            uint32_t leftoverY = rect.Height - height;
+            uint32_t shortSide = std::min(leftoverX, leftoverY);
+            uint32_t longSide = std::max(leftoverX, leftoverY);
+            if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+                best = &rect;
+                bestShort = shortSide;
+                bestLong = longSide;
+            }
+        }
+        if (!best) return false;
+
+        out = {best->X, best->Y, width, height};
+        Split(out);
+        return true;
+    }
+
+    bool Occupy(const AtlasRect& used) {
+        for (const AtlasRect& rect : FreeRects) {
+            if (rect.Contains(used)) {
+                Split(used);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Split(const AtlasRect& used) {
+        std::vector<AtlasRect> next;
+        next.reserve(FreeRects.size() + 4);
+        for (const AtlasRect& rect : FreeRects) {
+            if (!rect.Intersects(used)) {
+                next.push_back(rect);
+                continue;
+            }
+            // Up to four maximal leftovers: left, right, below and above the used area
+            if (used.X > rect.X) next.push_back({rect.X, rect.Y, used.X - rect.X, rect.Height});
+            if (used.X + used.Width < rect.X + rect.Width)
+                next.push_back({used.X + used.Width, rect.Y, rect.X + rect.Width - used.X - used.Width, rect.Height});
+            if (used.Y > rect.Y) next.push_back({rect.X, rect.Y, rect.Width, used.Y - rect.Y});
+            if (used.Y + used.Height < rect.Y + rect.Height)
+                next.push_back({rect.X, used.Y + used.Height, rect.Width, rect.Y + rect.Height - used.Y - used.Height});
+        }
+
+        // Drop rectangles contained in another one (of two equal ones, keep the first)
+        FreeRects.clear();
+        for (size_t i = 0; i < next.size(); i++) {
+            bool contained = false;
+            for (size_t j = 0; j < next.size() && !contained; j++) {
+                if (i == j || !next[j].Contains(next[i])) continue;
+                contained = !next[i].Contains(next[j]) || j < i;
+            }
+            if (!contained) FreeRects.push_back(next[i]);
+        }
+    }
+};
+
+TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding, const std::string& cachePath)
+    : m_PageSize(pageSize), m_Padding(padding), m_CachePath(cachePath) {
+    if (!m_CachePath.empty()) LoadLayout();
+}
+
+TextureAtlas::~TextureAtlas() = default;
+
+bool TextureAtlas::Place(uint32_t width, uint32_t height, const Placement* cached, Placement& out) {
+    const uint32_t paddedWidth = width + 2 * m_Padding;
+    const uint32_t paddedHeight = height + 2 * m_Padding;
+
+    auto addPage = [this]() {
+        m_Pages.push_back(std::make_unique<Page>(m_PageSize));
+        m_PageTextures.push_back(Texture2D::Create(m_PageSize, m_PageSize));
+    };
+
+    if (cached && cached->X >= m_Padding && cached->Y >= m_Padding) {
+        while (m_Pages.size() <= cached->Page) addPage();
+        AtlasRect rect = {cached->X - m_Padding, cached->Y - m_Padding, paddedWidth, paddedHeight};
+        if (m_Pages[cached->Page]->Occupy(rect)) {
+            out = *cached;
+            return true;
+        }
+    }
+
+    AtlasRect rect;
+    for (uint32_t page = 0; page <= m_Pages.size(); page++) {
+        if (page == m_Pages.size()) addPage();
+        if (m_Pages[page]->Insert(paddedWidth, paddedHeight, rect)) {
+            out = {page, rect.X + m_Padding, rect.Y + m_Padding, width, height};
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<SubTexture2D> TextureAtlas::Load(const std::string& path) {
+    auto existing = m_Regions.find(path);
+    if (existing != m_Regions.end()) return existing->second;
+
+    int width, height, channels;
+    stbi_set_flip_vertically_on_load(1); // OpenGL Left Bottom Origin, same as OpenGLTexture2D
+    stbi_uc* pixels = stbi_load(path.c_str(), &width, &height, &channels, 4);
+    if (!pixels) {
+        ENG_CORE_ERROR("TextureAtlas: failed to load image {0}", path);
+        return nullptr;
+    }
+
+    const uint32_t w = static_cast<uint32_t>(width);
+    const uint32_t h = static_cast<uint32_t>(height);
+    const uint32_t paddedWidth = w + 2 * m_Padding;
+    const uint32_t paddedHeight = h + 2 * m_Padding;
+
+    // Large images would waste most of a page, give them their own texture
+    if (paddedWidth > m_PageSize / 2 || paddedHeight > m_PageSize / 2) {
+        stbi_image_free(pixels);
+        std::shared_ptr<Texture2D> texture = Texture2D::Create(path);
+        if (!texture) return nullptr;
+        auto region = std::make_shared<SubTexture2D>(texture, Vec2(0.0f), Vec2(1.0f));
+        m_Regions[path] = region;
+        return region;
+    }
+
+    auto cached = m_CachedLayout.find(path);
+    const Placement* hint = nullptr;
+    if (cached != m_CachedLayout.end() && cached->second.Width == w && cached->second.Height == h) {
+        hint = &cached->second;
+    }
+
+    Placement placement;
+    if (!Place(w, h, hint, placement)) {
+        stbi_image_free(pixels);
+        ENG_CORE_ERROR("TextureAtlas: could not place image {0}", path);
+        return nullptr;
+    }
+
+    // Extrude the border into the padding by clamping the source coordinates
+    const uint32_t* source = reinterpret_cast<const uint32_t*>(pixels);
+    std::vector<uint32_t> padded(static_cast<size_t>(paddedWidth) * paddedHeight);
+    for (uint32_t y = 0; y < paddedHeight; y++) {
+        uint32_t sy = std::min(h - 1, y > m_Padding ? y - m_Padding : 0);
+        for (uint32_t x = 0; x < paddedWidth; x++) {
+            uint32_t sx = std::min(w - 1, x > m_Padding ? x - m_Padding : 0);
+            padded[static_cast<size_t>(y) * paddedWidth + x] = source[static_cast<size_t>(sy) * w + sx];
+        }
+    }
+    stbi_image_free(pixels);
+
+    const std::shared_ptr<Texture2D>& page = m_PageTextures[placement.Page];
+    page->SetSubData(padded.data(), placement.X - m_Padding, placement.Y - m_Padding, paddedWidth, paddedHeight);
+
+    const float size = static_cast<float>(m_PageSize);
+    Vec2 min = {placement.X / size, placement.Y / size};
+    Vec2 max = {(placement.X + w) / size, (placement.Y + h) / size};
+    auto region = std::make_shared<SubTexture2D>(page, min, max);
+
+    m_Layout[path] = placement;
+    m_Regions[path] = region;
+    return region;
+}
+
+// Layout cache format: a header line, then one line per image
+//   TextureAtlas 1 <pageSize> <padding>
+//   <page> <x> <y> <width> <height> <path>
+void TextureAtlas::LoadLayout() {
+    std::ifstream in(m_CachePath);
+    if (!in) return;
+
+    std::string magic;
+    uint32_t version = 0, pageSize = 0, padding = 0;
+    in >> magic >> version >> pageSize >> padding;
+    if (magic != "TextureAtlas" || version != 1 || pageSize != m_PageSize || padding != m_Padding) {
+        ENG_CORE_WARN("TextureAtlas: ignoring layout cache {0}, it was written for other settings", m_CachePath);
+        return;
+    }
+
+    Placement placement;
+    std::string path;
+    while (in >> placement.Page >> placement.X >> placement.Y >> placement.Width >> placement.Height) {
+        in.ignore(1);
+        std::getline(in, path);
+        m_CachedLayout[path] = placement;
+    }
+}
+
+bool TextureAtlas::SaveLayout() const {
+    if (m_CachePath.empty()) return false;
+
+    std::ofstream out(m_CachePath);
+    if (!out) {
+        ENG_CORE_ERROR("TextureAtlas: could not write layout cache {0}", m_CachePath);
+        return false;
+    }
+
+    // Sorted by position so the file diffs cleanly between runs
+    std::vector<std::pair<std::string, Placement>> entries(m_Layout.begin(), m_Layout.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        if (a.second.Page != b.second.Page) return a.second.Page < b.second.Page;
+        if (a.second.Y != b.second.Y) return a.second.Y < b.second.Y;
+        return a.second.X < b.second.X;
+    });
+
+    out << "TextureAtlas 1 " << m_PageSize << " " << m_Padding << "\n";
+    for (const auto& [path, placement] : entries) {
+        out << placement.Page << " " << placement.X << " " << placement.Y << " " << placement.Width << " "
+            << placement.Height << " " << path << "\n";
+    }
+    return true;
+}
+
+}
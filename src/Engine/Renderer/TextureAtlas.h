@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Renderer/Texture.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+// Packs small images into shared RGBA8 pages at load time, so sprites that would each need
+// their own texture slot end up in a handful of textures and batch together.
+//
+// Every image is surrounded by `padding` pixels of its own extruded border, which keeps linear
+// filtering from bleeding in the neighbours. Images too large for a page are loaded as
+// standalone textures and still come back as a SubTexture2D covering the whole texture.
+// Tiling repeats across the whole page, so keep the tiling factor at 1 for atlas regions.
+//
+// With a cache path, the packed layout is read on construction and reused for every image whose
+// size still matches, which keeps pages stable between runs; SaveLayout() writes it back.
+class TextureAtlas {
+public:
+    TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 2, const std::string& cachePath = "");
+    ~TextureAtlas();
+
+    // Loads and packs the image, or returns the region from an earlier Load of the same path.
+    // nullptr if the image cannot be read.
+    std::shared_ptr<SubTexture2D> Load(const std::string& path);
+
+    bool SaveLayout() const;
+
+    const std::vector<std::shared_ptr<Texture2D>>& GetPages() const { return m_PageTextures; }
+
+private:
+    struct Placement {
+        uint32_t Page;
+        uint32_t X, Y, Width, Height; // image size, without padding
+    };
+    struct Page;
+
+    bool Place(uint32_t width, uint32_t height, const Placement* cached, Placement& out);
+    void LoadLayout();
+
+    uint32_t m_PageSize;
+    uint32_t m_Padding;
+    std::string m_CachePath;
+
+    std::vector<std::unique_ptr<Page>> m_Pages;
+    std::vector<std::shared_ptr<Texture2D>> m_PageTextures;
+
+    std::unordered_map<std::string, std::shared_ptr<SubTexture2D>> m_Regions;
+    std::unordered_map<std::string, Placement> m_Layout; // packed this run, what SaveLayout writes
+    std::unordered_map<std::string, Placement> m_CachedLayout;
+};
+
+}
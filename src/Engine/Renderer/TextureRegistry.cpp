@@ -0,0 +1,51 @@
+#include "Engine/Renderer/TextureRegistry.h"
+#include "Engine/Core/Log.h"
+
+#include <vector>
+
+namespace Engine {
+
+struct RegistrySlot {
+    Texture* Instance = nullptr;
+    uint32_t Generation = 1; // starts at 1 so that no valid handle has the value 0
+};
+
+static std::vector<RegistrySlot> s_Slots;
+static std::vector<uint32_t> s_FreeIndices;
+
+TextureHandle TextureRegistry::Register(Texture* texture) {
+    uint32_t index;
+    if (!s_FreeIndices.empty()) {
+        index = s_FreeIndices.back();
+        s_FreeIndices.pop_back();
+    } else {
+        index = static_cast<uint32_t>(s_Slots.size());
+        ENG_CORE_ASSERT(index <= TextureHandle::INDEX_MASK, "Texture registry is full!");
+        s_Slots.emplace_back();
+    }
+    s_Slots[index].Instance = texture;
+    return TextureHandle(index, s_Slots[index].Generation);
+}
+
+void TextureRegistry::Unregister(TextureHandle handle) {
+    if (!Get(handle)) return;
+
+    RegistrySlot& slot = s_Slots[handle.GetIndex()];
+    slot.Instance = nullptr;
+    // Wrap within the generation bits, skipping 0 for the same reason as the initial value
+    slot.Generation = (slot.Generation + 1) & (0xffffffffu >> TextureHandle::INDEX_BITS);
+    if (slot.Generation == 0) slot.Generation = 1;
+    s_FreeIndices.push_back(handle.GetIndex());
+}
+
+Texture* TextureRegistry::Get(TextureHandle handle) {
+    uint32_t index = handle.GetIndex();
+    if (!handle.IsValid() || index >= s_Slots.size()) return nullptr;
+
+    const RegistrySlot& slot = s_Slots[index];
+    return slot.Generation == handle.GetGeneration() ? slot.Instance : nullptr;
+}
+
+uint32_t TextureRegistry::GetCapacity() { return static_cast<uint32_t>(s_Slots.size()); }
+
+}
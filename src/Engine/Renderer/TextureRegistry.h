@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Engine {
+
+class Texture;
+
+// Generational 32-bit texture handle. The low bits index the TextureRegistry, the high bits hold
+// the generation of that slot, so a handle to a destroyed texture never resolves to its successor.
+// A default-constructed handle (value 0) is invalid.
+class TextureHandle {
+public:
+    static constexpr uint32_t INDEX_BITS = 20;
+    static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+
+    TextureHandle() = default;
+    explicit TextureHandle(uint32_t value) : m_Value(value) {}
+    TextureHandle(uint32_t index, uint32_t generation) : m_Value((generation << INDEX_BITS) | index) {}
+
+    uint32_t GetIndex() const { return m_Value & INDEX_MASK; }
+    uint32_t GetGeneration() const { return m_Value >> INDEX_BITS; }
+    uint32_t GetValue() const { return m_Value; }
+    bool IsValid() const { return m_Value != 0; }
+
+    bool operator==(const TextureHandle& other) const { return m_Value == other.m_Value; }
+    bool operator!=(const TextureHandle& other) const { return m_Value != other.m_Value; }
+
+private:
+    uint32_t m_Value = 0;
+};
+
+// Maps handles to live textures. Every Texture registers itself on construction and
+// unregisters on destruction; the registry does not own them.
+class TextureRegistry {
+public:
+    static TextureHandle Register(Texture* texture);
+    static void Unregister(TextureHandle handle);
+
+    // nullptr for invalid or stale handles
+    static Texture* Get(TextureHandle handle);
+
+    // One past the highest index handed out so far, for tables indexed by GetIndex()
+    static uint32_t GetCapacity();
+};
+
+}
@@ -0,0 +1,138 @@
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/Buffer.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/VertexArray.h"
+#include "Engine/Core/Log.h"
+
+namespace Engine {
+
+static constexpr uint32_t CHUNK_TILES = Tilemap::CHUNK_SIZE * Tilemap::CHUNK_SIZE;
+
+Tilemap::Tilemap(uint32_t width, uint32_t height, const Vec2& tileSize, const Vec3& origin)
+    : m_Width(width), m_Height(height), m_ChunksX((width + CHUNK_SIZE - 1) / CHUNK_SIZE),
+      m_ChunksY((height + CHUNK_SIZE - 1) / CHUNK_SIZE), m_TileSize(tileSize), m_Origin(origin),
+      m_Tiles(static_cast<size_t>(m_ChunksX) * m_ChunksY * CHUNK_TILES, 0), m_Chunks(m_ChunksX * m_ChunksY) {}
+
+Tilemap::~Tilemap() = default;
+
+void Tilemap::SetTileset(const std::vector<std::shared_ptr<SubTexture2D>>& tiles) {
+    m_Texture.reset();
+    m_TexCoords.clear();
+    for (const auto& tile : tiles) {
+        if (!m_Texture) m_Texture = tile->GetTexture();
+        if (tile->GetTexture() != m_Texture) {
+            ENG_CORE_WARN("Tilemap: tileset regions must share one texture, region {0} does not",
+                          m_TexCoords.size());
+        }
+        const Vec2* coords = tile->GetTexCoords();
+        m_TexCoords.push_back({coords[0], coords[1], coords[2], coords[3]});
+    }
+    MarkAllDirty();
+}
+
+uint32_t Tilemap::TileIndex(uint32_t x, uint32_t y) const {
+    uint32_t chunk = (y / CHUNK_SIZE) * m_ChunksX + x / CHUNK_SIZE;
+    return chunk * CHUNK_TILES + (y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE;
+}
+
+void Tilemap::SetTile(uint32_t x, uint32_t y, uint16_t tile) {
+    if (x >= m_Width || y >= m_Height) return;
+    uint16_t& slot = m_Tiles[TileIndex(x, y)];
+    if (slot == tile) return;
+    slot = tile;
+    MarkDirty(x / CHUNK_SIZE, y / CHUNK_SIZE);
+}
+
+uint16_t Tilemap::GetTile(uint32_t x, uint32_t y) const {
+    if (x >= m_Width || y >= m_Height) return 0;
+    return m_Tiles[TileIndex(x, y)];
+}
+
+void Tilemap::Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t tile) {
+    uint32_t endX = std::min<uint64_t>(static_cast<uint64_t>(x) + width, m_Width);
+    uint32_t endY = std::min<uint64_t>(static_cast<uint64_t>(y) + height, m_Height);
+    for (uint32_t ty = y; ty < endY; ty++) {
+        for (uint32_t tx = x; tx < endX; tx++) m_Tiles[TileIndex(tx, ty)] = tile;
+    }
+    if (x >= endX || y >= endY) return;
+    for (uint32_t cy = y / CHUNK_SIZE; cy <= (endY - 1) / CHUNK_SIZE; cy++) {
+        for (uint32_t cx = x / CHUNK_SIZE; cx <= (endX - 1) / CHUNK_SIZE; cx++) MarkDirty(cx, cy);
+    }
+}
+
+void Tilemap::SetTint(const Vec4& tint) {
+    m_Tint = tint;
+    MarkAllDirty();
+}
+
+void Tilemap::MarkDirty(uint32_t chunkX, uint32_t chunkY) {
+    m_Chunks[chunkY * m_ChunksX + chunkX].Dirty = true;
+}
+
+void Tilemap::MarkAllDirty() {
+    // Chunks without a buffer are built from scratch anyway
+    for (uint32_t index : m_Resident) m_Chunks[index].Dirty = true;
+}
+
+uint32_t Tilemap::PrepareChunk(uint32_t chunkIndex, uint32_t stamp) {
+    Chunk& chunk = m_Chunks[chunkIndex];
+    chunk.LastDrawn = stamp;
+    if (chunk.Buffer && !chunk.Dirty) return 0;
+
+    if (!chunk.Buffer) {
+        if (m_Resident.size() >= m_MaxResident) {
+            // Recycle the buffer of the chunk that has gone unseen the longest
+            size_t oldest = 0;
+            for (size_t i = 1; i < m_Resident.size(); i++) {
+                if (m_Chunks[m_Resident[i]].LastDrawn < m_Chunks[m_Resident[oldest]].LastDrawn) oldest = i;
+            }
+            Chunk& victim = m_Chunks[m_Resident[oldest]];
+            chunk.Array = std::move(victim.Array);
+            chunk.Buffer = std::move(victim.Buffer);
+            victim.QuadCount = 0;
+            victim.Dirty = true;
+            m_Resident[oldest] = chunkIndex;
+        } else {
+            chunk.Buffer = VertexBuffer::Create(CHUNK_TILES * 4 * sizeof(QuadVertex));
+            chunk.Buffer->SetLayout(Renderer2D::GetQuadVertexLayout());
+            chunk.Array = VertexArray::Create();
+            chunk.Array->AddVertexBuffer(chunk.Buffer);
+            chunk.Array->SetIndexBuffer(Renderer2D::GetQuadIndexBuffer());
+            m_Resident.push_back(chunkIndex);
+        }
+    }
+
+    // The tileset texture is bound at slot 1; in TextureMode::Arrays that binds its array
+    float texIndex = 1.0f;
+    if (Renderer2D::GetTextureMode() == TextureMode::Arrays) {
+        uint32_t layer = m_Texture ? m_Texture->GetArrayLayer() : 0;
+        texIndex = static_cast<float>((1u << Renderer2D::ARRAY_LAYER_BITS) | layer);
+    }
+
+    m_Scratch.resize(CHUNK_TILES * 4);
+    QuadVertex* out = m_Scratch.data();
+    const uint16_t* tiles = m_Tiles.data() + static_cast<size_t>(chunkIndex) * CHUNK_TILES;
+    const uint32_t baseX = (chunkIndex % m_ChunksX) * CHUNK_SIZE;
+    const uint32_t baseY = (chunkIndex / m_ChunksX) * CHUNK_SIZE;
+    const uint32_t regions = static_cast<uint32_t>(m_TexCoords.size());
+
+    for (uint32_t ty = 0; ty < CHUNK_SIZE; ty++) {
+        for (uint32_t tx = 0; tx < CHUNK_SIZE; tx++) {
+            uint16_t tile = tiles[ty * CHUNK_SIZE + tx];
+            if (tile == 0 || tile > regions) continue;
+            Vec3 center = {m_Origin.x + (baseX + tx + 0.5f) * m_TileSize.x,
+                           m_Origin.y + (baseY + ty + 0.5f) * m_TileSize.y, m_Origin.z};
+            QuadKernels::EmitQuad(out, center, m_TileSize, 0.0f, m_Tint, texIndex, 1.0f,
+                                  m_TexCoords[tile - 1].data());
+            out += 4;
+        }
+    }
+
+    chunk.QuadCount = static_cast<uint32_t>((out - m_Scratch.data()) / 4);
+    chunk.Dirty = false;
+    uint32_t size = chunk.QuadCount * 4 * sizeof(QuadVertex);
+    if (size > 0) chunk.Buffer->SetData(m_Scratch.data(), size);
+    return size;
+}
+
+}
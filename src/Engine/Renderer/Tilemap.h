@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Engine/Renderer/QuadKernels.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Core/Math.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+class VertexArray;
+class VertexBuffer;
+
+// Grid of tile ids drawn with Renderer2D::DrawTilemap. Tiles are grouped into CHUNK_SIZE^2
+// chunks, each with its own GPU vertex buffer built from the tileset. Edits only mark their chunk
+// dirty; a chunk is (re)built the next time it is drawn, so a frame costs the chunks in view, not
+// the map size. Chunks that go unseen give their buffers back once more than the resident limit
+// are built, which bounds GPU memory on large maps.
+//
+// Tile t > 0 draws tileset region t - 1, tile 0 is empty. Regions must all come from one texture,
+// e.g. SubTexture2D::CreateFromCoords cells or TextureAtlas regions on one page.
+class Tilemap {
+public:
+    static constexpr uint32_t CHUNK_SIZE = 32; // tiles per chunk side
+
+    // Tile (0, 0) has its lower-left corner at origin, x grows right and y up
+    Tilemap(uint32_t width, uint32_t height, const Vec2& tileSize = Vec2(1.0f), const Vec3& origin = Vec3(0.0f));
+    ~Tilemap();
+
+    void SetTileset(const std::vector<std::shared_ptr<SubTexture2D>>& tiles);
+
+    void SetTile(uint32_t x, uint32_t y, uint16_t tile);
+    uint16_t GetTile(uint32_t x, uint32_t y) const;
+    // Clipped to the map
+    void Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t tile);
+
+    void SetTint(const Vec4& tint);
+
+    // Built chunks kept on the GPU; the least recently drawn one is recycled beyond this
+    void SetMaxResidentChunks(uint32_t count) { m_MaxResident = count < 1 ? 1 : count; }
+    uint32_t GetResidentChunkCount() const { return static_cast<uint32_t>(m_Resident.size()); }
+
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+    const Vec2& GetTileSize() const { return m_TileSize; }
+    const Vec3& GetOrigin() const { return m_Origin; }
+
+private:
+    friend class Renderer2D;
+
+    struct Chunk {
+        std::shared_ptr<VertexArray> Array;
+        std::shared_ptr<VertexBuffer> Buffer;
+        uint32_t QuadCount = 0;
+        uint32_t LastDrawn = 0; // Renderer2D draw stamp
+        bool Dirty = true;
+    };
+
+    uint32_t TileIndex(uint32_t x, uint32_t y) const;
+    void MarkDirty(uint32_t chunkX, uint32_t chunkY);
+    void MarkAllDirty();
+    // Makes the chunk resident and current for drawing, returns the bytes uploaded
+    uint32_t PrepareChunk(uint32_t chunkIndex, uint32_t stamp);
+
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_ChunksX;
+    uint32_t m_ChunksY;
+    Vec2 m_TileSize;
+    Vec3 m_Origin;
+    Vec4 m_Tint = Vec4(1.0f);
+
+    // Chunk-major, CHUNK_SIZE^2 tiles per chunk, so a rebuild reads one contiguous block
+    std::vector<uint16_t> m_Tiles;
+    std::vector<Chunk> m_Chunks;
+    std::vector<uint32_t> m_Resident; // chunk indices holding a vertex buffer
+    uint32_t m_MaxResident = 1024;
+
+    std::shared_ptr<Texture2D> m_Texture;
+    std::vector<std::array<Vec2, 4>> m_TexCoords; // per tileset region
+    std::vector<QuadVertex> m_Scratch;            // one chunk of vertices while building
+};
+
+}
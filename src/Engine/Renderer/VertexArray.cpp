@@ -1,6 +1,7 @@
 #include "Engine/Renderer/VertexArray.h"
 #include "Engine/Renderer/RendererAPI.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Capture/CaptureVertexArray.h"
 
 namespace Engine {
 
@@ -8,6 +9,7 @@ std::shared_ptr<VertexArray> VertexArray::Create() {
     switch (RendererAPI::GetAPI()) {
         case RendererAPI::API::None:    return nullptr;
         case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLVertexArray>();
+        case RendererAPI::API::Capture: return std::make_shared<CaptureVertexArray>();
     }
     return nullptr;
 }
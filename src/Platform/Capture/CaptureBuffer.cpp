@@ -0,0 +1,71 @@
+#include "Platform/Capture/CaptureBuffer.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Engine {
+
+// Object: buffer, Args: size, region count (stream buffers)
+// UploadBuffer Args: offset, size. The bytes themselves are copied per draw.
+
+CaptureVertexBuffer::CaptureVertexBuffer(uint32_t size) {
+    m_ID = CaptureRecorder::NewObject();
+    m_Bytes.resize(size);
+    CaptureRecorder::Record(CaptureCommandType::CreateBuffer, m_ID, {size, 1});
+}
+
+CaptureVertexBuffer::CaptureVertexBuffer(float* vertices, uint32_t size) : CaptureVertexBuffer(size) {
+    SetData(vertices, size);
+}
+
+void CaptureVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+    if (offset + size > m_Bytes.size()) return;
+
+    std::memcpy(m_Bytes.data() + offset, data, size);
+    CaptureRecorder::Record(CaptureCommandType::UploadBuffer, m_ID, {offset, size});
+}
+
+CaptureStreamVertexBuffer::CaptureStreamVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+    : m_RegionSize(regionSize), m_RegionCount(regionCount) {
+    m_ID = CaptureRecorder::NewObject();
+    m_Bytes.resize(static_cast<size_t>(regionSize) * regionCount);
+    CaptureRecorder::Record(CaptureCommandType::CreateBuffer, m_ID, {regionSize, regionCount});
+}
+
+void CaptureStreamVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+    std::memcpy(static_cast<uint8_t*>(Map()) + offset, data, size);
+    Unmap(offset + size);
+    Fence();
+}
+
+void* CaptureStreamVertexBuffer::Map() {
+    return m_Bytes.data() + static_cast<size_t>(m_Region) * m_RegionSize;
+}
+
+uint32_t CaptureStreamVertexBuffer::Unmap(uint32_t usedSize) {
+    uint32_t offset = m_Region * m_RegionSize;
+    CaptureRecorder::Record(CaptureCommandType::UploadBuffer, m_ID, {offset, usedSize});
+    return offset;
+}
+
+void CaptureStreamVertexBuffer::Fence() {
+    m_Region = (m_Region + 1) % m_RegionCount;
+}
+
+CaptureIndexBuffer::CaptureIndexBuffer(uint32_t* indices, uint32_t count) : m_ID(CaptureRecorder::NewObject()) {
+    m_PrefixMax.resize(count);
+    uint32_t largest = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        largest = std::max(largest, indices[i]);
+        m_PrefixMax[i] = largest;
+    }
+    CaptureRecorder::Record(CaptureCommandType::CreateBuffer, m_ID, {count * static_cast<uint32_t>(sizeof(uint32_t)), 1});
+}
+
+uint32_t CaptureIndexBuffer::GetVertexCount(uint32_t count) const {
+    if (count == 0 || m_PrefixMax.empty()) return 0;
+    return m_PrefixMax[std::min<size_t>(count, m_PrefixMax.size()) - 1] + 1;
+}
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Engine/Renderer/Buffer.h"
+
+#include <vector>
+
+namespace Engine {
+
+// CPU-side contents shared by the capture vertex buffer types, read back when a draw is recorded
+class CaptureBufferStorage {
+public:
+    virtual ~CaptureBufferStorage() = default;
+
+    uint32_t GetID() const { return m_ID; }
+    const uint8_t* GetBytes() const { return m_Bytes.data(); }
+    size_t GetByteSize() const { return m_Bytes.size(); }
+
+protected:
+    uint32_t m_ID = 0;
+    std::vector<uint8_t> m_Bytes;
+};
+
+class CaptureVertexBuffer : public VertexBuffer, public CaptureBufferStorage {
+public:
+    CaptureVertexBuffer(uint32_t size);
+    CaptureVertexBuffer(float* vertices, uint32_t size);
+
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+    virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+private:
+    BufferLayout m_Layout;
+};
+
+// Same ring semantics as the GL stream buffer, minus the waiting: Map hands out the next region
+// of plain memory and Unmap records the upload.
+class CaptureStreamVertexBuffer : public StreamVertexBuffer, public CaptureBufferStorage {
+public:
+    CaptureStreamVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+    virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+    virtual void* Map() override;
+    virtual uint32_t Unmap(uint32_t usedSize) override;
+    virtual void Fence() override;
+
+    virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+    virtual float GetLastWaitTime() const override { return 0.0f; }
+
+private:
+    BufferLayout m_Layout;
+
+    uint32_t m_RegionSize;
+    uint32_t m_RegionCount;
+    uint32_t m_Region = 0;
+};
+
+class CaptureIndexBuffer : public IndexBuffer {
+public:
+    CaptureIndexBuffer(uint32_t* indices, uint32_t count);
+
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+
+    virtual uint32_t GetCount() const override { return static_cast<uint32_t>(m_PrefixMax.size()); }
+
+    uint32_t GetID() const { return m_ID; }
+    // Number of vertices the first `count` indices reach, counted from the base vertex
+    uint32_t GetVertexCount(uint32_t count) const;
+
+private:
+    uint32_t m_ID;
+    std::vector<uint32_t> m_PrefixMax; // largest index among the first i + 1
+};
+
+}
@@ -0,0 +1,47 @@
+#include "Platform/Capture/CaptureFramebuffer.h"
+#include "Platform/Capture/CaptureRecorder.h"
+#include "Platform/Capture/CaptureTexture.h"
+
+namespace Engine {
+
+// CreateFramebuffer Args: width, height, color attachment count; data: attachment texture ids,
+// colors then depth (0 without one). Resizing records a new CreateFramebuffer under the same id.
+// BindFramebuffer Object: the framebuffer, 0 for the default one
+
+CaptureFramebuffer::CaptureFramebuffer(const FramebufferSpec& spec)
+    : Framebuffer(spec), m_ID(CaptureRecorder::NewObject()) {
+    Invalidate();
+}
+
+void CaptureFramebuffer::Invalidate() {
+    uint32_t textures[MAX_COLOR_ATTACHMENTS + 1] = {};
+    const uint32_t colorCount = static_cast<uint32_t>(m_Spec.ColorAttachments.size());
+    for (uint32_t i = 0; i < colorCount; i++) {
+        m_ColorAttachments[i] = std::make_shared<CaptureTexture2D>(m_Spec.Width, m_Spec.Height,
+                                                                   m_Spec.ColorAttachments[i]);
+        textures[i] = m_ColorAttachments[i]->GetRendererID();
+    }
+    m_DepthAttachment.reset();
+    if (m_Spec.DepthAttachment != RenderTargetFormat::None) {
+        m_DepthAttachment = std::make_shared<CaptureTexture2D>(m_Spec.Width, m_Spec.Height, m_Spec.DepthAttachment);
+        textures[colorCount] = m_DepthAttachment->GetRendererID();
+    }
+    CaptureRecorder::Record(CaptureCommandType::CreateFramebuffer, m_ID, {m_Spec.Width, m_Spec.Height, colorCount},
+                            textures, (colorCount + 1) * sizeof(uint32_t));
+}
+
+void CaptureFramebuffer::Bind() {
+    CaptureRecorder::Record(CaptureCommandType::BindFramebuffer, m_ID);
+    CaptureRecorder::Record(CaptureCommandType::SetViewport, 0, {0, 0, m_Spec.Width, m_Spec.Height});
+}
+
+void CaptureFramebuffer::Unbind() { CaptureRecorder::Record(CaptureCommandType::BindFramebuffer, 0); }
+
+void CaptureFramebuffer::Resize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || (width == m_Spec.Width && height == m_Spec.Height)) return;
+    m_Spec.Width = width;
+    m_Spec.Height = height;
+    Invalidate();
+}
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+
+#include <array>
+
+namespace Engine {
+
+// Records creation and binds; the attachments are CaptureTexture2Ds of the spec's formats
+class CaptureFramebuffer : public Framebuffer {
+public:
+    explicit CaptureFramebuffer(const FramebufferSpec& spec);
+
+    virtual void Bind() override;
+    virtual void Unbind() override;
+    virtual void Resize(uint32_t width, uint32_t height) override;
+
+    virtual const std::shared_ptr<Texture2D>& GetColorAttachment(uint32_t index = 0) const override {
+        return m_ColorAttachments[index];
+    }
+    virtual const std::shared_ptr<Texture2D>& GetDepthAttachment() const override { return m_DepthAttachment; }
+
+private:
+    void Invalidate();
+
+    uint32_t m_ID = 0;
+    std::array<std::shared_ptr<Texture2D>, MAX_COLOR_ATTACHMENTS> m_ColorAttachments;
+    std::shared_ptr<Texture2D> m_DepthAttachment;
+};
+
+}
@@ -0,0 +1,33 @@
+#include "Platform/Capture/CaptureGPUTimer.h"
+#include "Engine/Core/Profiler.h"
+
+namespace Engine {
+
+CaptureGPUTimer::CaptureGPUTimer(uint32_t framesInFlight) : m_Frames(framesInFlight < 2 ? 2 : framesInFlight) {}
+
+bool CaptureGPUTimer::BeginFrame() {
+    m_Frame = (m_Frame + 1) % m_Frames.size();
+    // The slot about to be reused holds the oldest frame, which is "finished" by now
+    std::vector<GPUTimerRange>& frame = m_Frames[m_Frame];
+    bool collected = !frame.empty();
+    if (collected) m_Results.swap(frame);
+    frame.clear();
+    m_Depth = 0;
+    return collected;
+}
+
+uint32_t CaptureGPUTimer::BeginRange(const char* name) {
+    std::vector<GPUTimerRange>& frame = m_Frames[m_Frame];
+    uint64_t now = Profiler::ClockNow();
+    frame.push_back({name, now, now, m_Depth++});
+    return static_cast<uint32_t>(frame.size() - 1);
+}
+
+void CaptureGPUTimer::EndRange(uint32_t range) {
+    std::vector<GPUTimerRange>& frame = m_Frames[m_Frame];
+    if (range >= frame.size()) return;
+    frame[range].End = Profiler::ClockNow();
+    if (m_Depth > 0) m_Depth--;
+}
+
+}
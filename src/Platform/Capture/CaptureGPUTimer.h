@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Engine/Renderer/GPUTimer.h"
+
+namespace Engine {
+
+// No GPU to time: ranges take Profiler::ClockNow() at BeginRange / EndRange, i.e. measure
+// submission, and are delivered framesInFlight frames later, the latest real results can arrive,
+// so the readback path runs headless.
+class CaptureGPUTimer : public GPUTimer {
+public:
+    explicit CaptureGPUTimer(uint32_t framesInFlight);
+
+    virtual bool BeginFrame() override;
+    virtual uint32_t BeginRange(const char* name) override;
+    virtual void EndRange(uint32_t range) override;
+
+    virtual const std::vector<GPUTimerRange>& GetResults() const override { return m_Results; }
+    virtual uint32_t GetDroppedFrames() const override { return 0; }
+
+private:
+    std::vector<std::vector<GPUTimerRange>> m_Frames;
+    uint32_t m_Frame = 0;
+    uint32_t m_Depth = 0;
+    std::vector<GPUTimerRange> m_Results;
+};
+
+}
@@ -0,0 +1,248 @@
+#include "Platform/Capture/CaptureRecorder.h"
+#include "Platform/Capture/CaptureBuffer.h"
+#include "Platform/Capture/CaptureShader.h"
+#include "Platform/Capture/CaptureVertexArray.h"
+#include "Engine/Core/Log.h"
+
+#include <cstring>
+#include <fstream>
+#include <glm/gtc/packing.hpp>
+#include <unordered_map>
+
+namespace Engine {
+
+struct CapturedVertexBuffer {
+    uint32_t Buffer;
+    BufferLayout Layout;
+};
+
+static uint32_t s_NextObject = 1;
+static bool s_RecordGeometry = true;
+static uint32_t s_DrawCount = 0;
+static std::vector<CaptureCommand> s_Commands;
+static std::vector<uint8_t> s_Data;
+// Vertex array -> its buffers in attribute order, needed to decode draws
+static std::unordered_map<uint32_t, std::vector<CapturedVertexBuffer>> s_VertexArrays;
+
+static uint32_t AppendData(const void* data, size_t size) {
+    uint32_t offset = static_cast<uint32_t>(s_Data.size());
+    s_Data.resize(s_Data.size() + size);
+    std::memcpy(s_Data.data() + offset, data, size);
+    return offset;
+}
+
+uint32_t CaptureRecorder::NewObject() { return s_NextObject++; }
+
+void CaptureRecorder::Record(CaptureCommandType type, uint32_t object, std::initializer_list<uint32_t> args,
+                             const void* data, uint32_t size) {
+    CaptureCommand command;
+    command.Type = type;
+    command.Object = object;
+    std::copy(args.begin(), args.begin() + std::min<size_t>(args.size(), 4), command.Args);
+    if (size > 0) {
+        command.DataOffset = AppendData(data, size);
+        command.DataSize = size;
+    }
+    s_Commands.push_back(command);
+}
+
+// Draw data: per vertex buffer of the array, a uint32_t element count followed by the elements
+void CaptureRecorder::RecordDraw(CaptureCommandType type, const VertexArray& vertexArray,
+                                 std::initializer_list<uint32_t> args, uint32_t firstVertex, uint32_t vertexCount,
+                                 uint32_t firstInstance, uint32_t instanceCount) {
+    uint32_t id = static_cast<const CaptureVertexArray&>(vertexArray).GetID();
+    Record(type, id, args);
+    s_DrawCount++;
+    if (!s_RecordGeometry) return;
+
+    CaptureCommand& command = s_Commands.back();
+    command.DataOffset = static_cast<uint32_t>(s_Data.size());
+    for (const auto& buffer : vertexArray.GetVertexBuffers()) {
+        auto* storage = dynamic_cast<const CaptureBufferStorage*>(buffer.get());
+        const BufferLayout& layout = buffer->GetLayout();
+        size_t stride = layout.GetStride();
+        bool perInstance = layout.GetInstanceDivisor() > 0;
+        size_t first = perInstance ? firstInstance : firstVertex;
+        size_t count = perInstance ? instanceCount : vertexCount;
+
+        // Never read past the buffer, whatever the draw asked for
+        size_t available = storage && stride ? storage->GetByteSize() / stride : 0;
+        first = std::min(first, available);
+        count = std::min(count, available - first);
+
+        uint32_t recorded = static_cast<uint32_t>(count);
+        AppendData(&recorded, sizeof(recorded));
+        if (count > 0) AppendData(storage->GetBytes() + first * stride, count * stride);
+    }
+    command.DataSize = static_cast<uint32_t>(s_Data.size()) - command.DataOffset;
+}
+
+void CaptureRecorder::RecordVertexBuffer(uint32_t vertexArray, uint32_t buffer, const BufferLayout& layout) {
+    s_VertexArrays[vertexArray].push_back({buffer, layout});
+    Record(CaptureCommandType::AddVertexBuffer, vertexArray, {buffer});
+}
+
+void CaptureRecorder::SetRecordGeometry(bool record) { s_RecordGeometry = record; }
+
+bool CaptureRecorder::GetRecordGeometry() { return s_RecordGeometry; }
+
+const std::vector<CaptureCommand>& CaptureRecorder::GetCommands() { return s_Commands; }
+
+const std::vector<uint8_t>& CaptureRecorder::GetData() { return s_Data; }
+
+uint32_t CaptureRecorder::GetDrawCount() { return s_DrawCount; }
+
+void CaptureRecorder::Clear() {
+    s_Commands.clear();
+    s_Data.clear();
+    s_DrawCount = 0;
+}
+
+// --- Dump ---
+
+static const char* GetCommandName(CaptureCommandType type) {
+    switch (type) {
+        case CaptureCommandType::Init:                 return "init";
+        case CaptureCommandType::SetViewport:          return "set_viewport";
+        case CaptureCommandType::SetClearColor:        return "set_clear_color";
+        case CaptureCommandType::Clear:                return "clear";
+        case CaptureCommandType::SetDepthTest:         return "set_depth_test";
+        case CaptureCommandType::SetBlendFunc:         return "set_blend_func";
+        case CaptureCommandType::CreateVertexArray:    return "create_vertex_array";
+        case CaptureCommandType::AddVertexBuffer:      return "add_vertex_buffer";
+        case CaptureCommandType::SetIndexBuffer:       return "set_index_buffer";
+        case CaptureCommandType::CreateBuffer:         return "create_buffer";
+        case CaptureCommandType::UploadBuffer:         return "upload_buffer";
+        case CaptureCommandType::CreateTexture:        return "create_texture";
+        case CaptureCommandType::UploadTexture:        return "upload_texture";
+        case CaptureCommandType::BindTexture:          return "bind_texture";
+        case CaptureCommandType::CreateShader:         return "create_shader";
+        case CaptureCommandType::BindShader:           return "bind_shader";
+        case CaptureCommandType::SetUniform:           return "set_uniform";
+        case CaptureCommandType::CreateFramebuffer:    return "create_framebuffer";
+        case CaptureCommandType::BindFramebuffer:      return "bind_framebuffer";
+        case CaptureCommandType::DrawIndexed:          return "draw_indexed";
+        case CaptureCommandType::DrawIndexedInstanced: return "draw_indexed_instanced";
+        case CaptureCommandType::DrawArraysInstanced:  return "draw_arrays_instanced";
+    }
+    return "unknown";
+}
+
+template<typename T>
+static void WriteValues(std::ofstream& out, const uint8_t* data, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        T value;
+        std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+        out << (i ? ", " : "") << +value;
+    }
+}
+
+// Raw values, so that a change in packing shows up in a diff
+static void WriteElement(std::ofstream& out, const BufferElement& element, const uint8_t* data) {
+    uint32_t count = element.GetComponentCount();
+    out << element.Name << "=(";
+    switch (element.Type) {
+        case ShaderDataType::Float:
+        case ShaderDataType::Float2:
+        case ShaderDataType::Float3:
+        case ShaderDataType::Float4:
+        case ShaderDataType::Mat3:
+        case ShaderDataType::Mat4:    WriteValues<float>(out, data, count); break;
+        case ShaderDataType::Int:
+        case ShaderDataType::Int2:
+        case ShaderDataType::Int3:
+        case ShaderDataType::Int4:    WriteValues<int32_t>(out, data, count); break;
+        case ShaderDataType::Bool:
+        case ShaderDataType::UByte:
+        case ShaderDataType::UByte4:  WriteValues<uint8_t>(out, data, count); break;
+        case ShaderDataType::UShort:
+        case ShaderDataType::UShort2:
+        case ShaderDataType::UShort4: WriteValues<uint16_t>(out, data, count); break;
+        case ShaderDataType::Half: {
+            uint16_t half;
+            std::memcpy(&half, data, sizeof(half));
+            out << glm::unpackHalf1x16(half);
+            break;
+        }
+        case ShaderDataType::None: break;
+    }
+    out << ")";
+}
+
+static void WriteDrawGeometry(std::ofstream& out, const CaptureCommand& command) {
+    auto it = s_VertexArrays.find(command.Object);
+    if (it == s_VertexArrays.end() || command.DataSize == 0) return;
+
+    const uint8_t* data = s_Data.data() + command.DataOffset;
+    const uint8_t* end = data + command.DataSize;
+    for (const CapturedVertexBuffer& buffer : it->second) {
+        if (data + sizeof(uint32_t) > end) break;
+        uint32_t count;
+        std::memcpy(&count, data, sizeof(count));
+        data += sizeof(count);
+
+        bool perInstance = buffer.Layout.GetInstanceDivisor() > 0;
+        const char* kind = perInstance ? "instance" : "vertex";
+        out << "  buffer " << buffer.Buffer << ": " << count << (perInstance ? " instances\n" : " vertices\n");
+        for (uint32_t i = 0; i < count; i++, data += buffer.Layout.GetStride()) {
+            out << "    " << kind << " " << i << ":";
+            for (const BufferElement& element : buffer.Layout) {
+                out << " ";
+                WriteElement(out, element, data + element.Offset);
+            }
+            out << "\n";
+        }
+    }
+}
+
+bool CaptureRecorder::Dump(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        ENG_CORE_ERROR("Capture: could not write {0}", path);
+        return false;
+    }
+
+    out << "# capture: " << s_Commands.size() << " commands, " << s_DrawCount << " draws\n";
+    for (const CaptureCommand& command : s_Commands) {
+        const uint8_t* data = s_Data.data() + command.DataOffset;
+        out << GetCommandName(command.Type) << " " << command.Object;
+        switch (command.Type) {
+            case CaptureCommandType::SetUniform: {
+                std::string name(reinterpret_cast<const char*>(data));
+                const uint8_t* values = data + name.size() + 1;
+                out << " " << name << " = [";
+                if (command.Args[0] == CaptureShader::IntUniform) {
+                    WriteValues<int32_t>(out, values, command.Args[1]);
+                } else {
+                    WriteValues<float>(out, values, command.Args[1]);
+                }
+                out << "]\n";
+                break;
+            }
+            case CaptureCommandType::SetClearColor:
+                out << " [";
+                WriteValues<float>(out, data, 4);
+                out << "]\n";
+                break;
+            case CaptureCommandType::CreateShader:
+            case CaptureCommandType::CreateTexture:
+                for (uint32_t arg : command.Args) out << " " << arg;
+                if (command.DataSize) out << " " << std::string(reinterpret_cast<const char*>(data), command.DataSize);
+                out << "\n";
+                break;
+            default:
+                for (uint32_t arg : command.Args) out << " " << arg;
+                out << "\n";
+                break;
+        }
+
+        if (command.Type == CaptureCommandType::DrawIndexed ||
+            command.Type == CaptureCommandType::DrawIndexedInstanced ||
+            command.Type == CaptureCommandType::DrawArraysInstanced) {
+            WriteDrawGeometry(out, command);
+        }
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Engine/Renderer/Buffer.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+class VertexArray;
+
+enum class CaptureCommandType : uint8_t {
+    Init, SetViewport, SetClearColor, Clear, SetDepthTest, SetBlendFunc,
+    CreateVertexArray, AddVertexBuffer, SetIndexBuffer,
+    CreateBuffer, UploadBuffer,
+    CreateTexture, UploadTexture, BindTexture,
+    CreateShader, BindShader, SetUniform,
+    CreateFramebuffer, BindFramebuffer,
+    DrawIndexed, DrawIndexedInstanced, DrawArraysInstanced
+};
+
+// Meaning of Object and Args per type is documented next to each Record call in Platform/Capture.
+// Data points into CaptureRecorder::GetData(): the vertices and instances a draw read, uniform
+// values, or object names.
+struct CaptureCommand {
+    CaptureCommandType Type;
+    uint32_t Object = 0;
+    uint32_t Args[4] = {};
+    uint32_t DataOffset = 0;
+    uint32_t DataSize = 0;
+};
+
+// In-memory command stream of the Capture renderer backend (RendererAPI::API::Capture).
+// Every object the backend creates gets an id, and every state change, upload and draw is
+// appended here in submission order. Draws copy the vertex and instance ranges they read, so the
+// stream can be dumped and diffed without replaying uploads; turn that off with
+// SetRecordGeometry(false) when only the submission cost matters.
+class CaptureRecorder {
+public:
+    static uint32_t NewObject();
+
+    static void Record(CaptureCommandType type, uint32_t object, std::initializer_list<uint32_t> args = {},
+                       const void* data = nullptr, uint32_t size = 0);
+    // Copies the ranges of every vertex buffer of `vertexArray` the draw reads: per-vertex buffers
+    // [firstVertex, firstVertex + vertexCount), per-instance ones [firstInstance, firstInstance + instanceCount)
+    static void RecordDraw(CaptureCommandType type, const VertexArray& vertexArray,
+                           std::initializer_list<uint32_t> args, uint32_t firstVertex, uint32_t vertexCount,
+                           uint32_t firstInstance, uint32_t instanceCount);
+    static void RecordVertexBuffer(uint32_t vertexArray, uint32_t buffer, const BufferLayout& layout);
+
+    static void SetRecordGeometry(bool record);
+    static bool GetRecordGeometry();
+
+    static const std::vector<CaptureCommand>& GetCommands();
+    static const std::vector<uint8_t>& GetData();
+    static uint32_t GetDrawCount();
+
+    // Drops the recorded commands; object ids and vertex layouts are kept
+    static void Clear();
+
+    // Text dump, one command per line with decoded vertices under each draw
+    static bool Dump(const std::string& path);
+};
+
+}
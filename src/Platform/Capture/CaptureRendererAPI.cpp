@@ -0,0 +1,74 @@
+#include "Platform/Capture/CaptureRendererAPI.h"
+#include "Platform/Capture/CaptureBuffer.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+namespace Engine {
+
+// SetViewport Args: x, y, width, height. SetClearColor data: 4 floats.
+// SetDepthTest Args: enabled. SetBlendFunc Args: BlendFunc.
+// Draw Object: vertex array
+//   DrawIndexed Args:          index count, base vertex
+//   DrawIndexedInstanced Args: index count, instance count
+//   DrawArraysInstanced Args:  vertex count, instance count, base instance
+
+static uint32_t GetIndexedVertexCount(const VertexArray& vertexArray, uint32_t& indexCount) {
+    auto* indexBuffer = dynamic_cast<const CaptureIndexBuffer*>(vertexArray.GetIndexBuffer().get());
+    if (!indexBuffer) return 0;
+    if (indexCount == 0) indexCount = indexBuffer->GetCount();
+    return indexBuffer->GetVertexCount(indexCount);
+}
+
+void CaptureRendererAPI::Init() {
+    CaptureRecorder::Record(CaptureCommandType::Init, 0);
+}
+
+void CaptureRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    CaptureRecorder::Record(CaptureCommandType::SetViewport, 0, {x, y, width, height});
+}
+
+void CaptureRendererAPI::SetClearColor(const glm::vec4& color) {
+    CaptureRecorder::Record(CaptureCommandType::SetClearColor, 0, {}, &color, sizeof(color));
+}
+
+void CaptureRendererAPI::Clear() {
+    CaptureRecorder::Record(CaptureCommandType::Clear, 0);
+}
+
+void CaptureRendererAPI::SetDepthTest(bool enabled) {
+    CaptureRecorder::Record(CaptureCommandType::SetDepthTest, 0, {enabled ? 1u : 0u});
+}
+
+void CaptureRendererAPI::SetBlendFunc(BlendFunc func) {
+    CaptureRecorder::Record(CaptureCommandType::SetBlendFunc, 0, {static_cast<uint32_t>(func)});
+}
+
+RendererCaps CaptureRendererAPI::GetCaps() const {
+    RendererCaps caps;
+    caps.MaxTextureSlots = 32;
+    caps.MaxTextureSize = 16384;
+    caps.MaxArrayTextureLayers = 2048;
+    return caps;
+}
+
+void CaptureRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                     uint32_t baseVertex) {
+    uint32_t vertexCount = GetIndexedVertexCount(*vertexArray, indexCount);
+    CaptureRecorder::RecordDraw(CaptureCommandType::DrawIndexed, *vertexArray, {indexCount, baseVertex}, baseVertex,
+                                vertexCount, 0, 0);
+}
+
+void CaptureRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                              uint32_t instanceCount) {
+    uint32_t vertexCount = GetIndexedVertexCount(*vertexArray, indexCount);
+    CaptureRecorder::RecordDraw(CaptureCommandType::DrawIndexedInstanced, *vertexArray, {indexCount, instanceCount},
+                                0, vertexCount, 0, instanceCount);
+}
+
+void CaptureRendererAPI::DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                             uint32_t instanceCount, uint32_t baseInstance) {
+    CaptureRecorder::RecordDraw(CaptureCommandType::DrawArraysInstanced, *vertexArray,
+                                {vertexCount, instanceCount, baseInstance}, 0, vertexCount, baseInstance,
+                                instanceCount);
+}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Renderer/VertexArray.h"
+
+namespace Engine {
+
+// Headless backend: nothing is drawn, everything is recorded into CaptureRecorder.
+// Reports the limits of a typical GL 4.5 desktop device.
+class CaptureRendererAPI : public RendererAPI {
+public:
+    virtual void Init() override;
+    virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    virtual void SetClearColor(const glm::vec4& color) override;
+    virtual void Clear() override;
+    virtual RendererCaps GetCaps() const override;
+    virtual void SetDepthTest(bool enabled) override;
+    virtual void SetBlendFunc(BlendFunc func) override;
+
+    virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0,
+                             uint32_t baseVertex = 0) override;
+    virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                      uint32_t instanceCount) override;
+    virtual void DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                     uint32_t instanceCount, uint32_t baseInstance = 0) override;
+};
+
+}
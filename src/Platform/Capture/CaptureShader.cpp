@@ -0,0 +1,54 @@
+#include "Platform/Capture/CaptureShader.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+#include <cstring>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace Engine {
+
+// CreateShader data: "<vertex path>;<fragment path>"
+// SetUniform Args: UniformType, value count; data: name, '\0', then the 4-byte values
+
+CaptureShader::CaptureShader(const std::string& vertexPath, const std::string& fragmentPath)
+    : m_ID(CaptureRecorder::NewObject()) {
+    std::string name = vertexPath + ";" + fragmentPath;
+    CaptureRecorder::Record(CaptureCommandType::CreateShader, m_ID, {}, name.data(), static_cast<uint32_t>(name.size()));
+}
+
+void CaptureShader::Bind() const {
+    CaptureRecorder::Record(CaptureCommandType::BindShader, m_ID);
+}
+
+void CaptureShader::RecordUniform(const std::string& name, UniformType type, const void* values, uint32_t count) {
+    m_Scratch.resize(name.size() + 1 + count * 4);
+    std::memcpy(m_Scratch.data(), name.c_str(), name.size() + 1);
+    std::memcpy(m_Scratch.data() + name.size() + 1, values, count * 4);
+    CaptureRecorder::Record(CaptureCommandType::SetUniform, m_ID, {type, count}, m_Scratch.data(),
+                            static_cast<uint32_t>(m_Scratch.size()));
+}
+
+void CaptureShader::SetInt(const std::string& name, int value) {
+    RecordUniform(name, IntUniform, &value, 1);
+}
+
+void CaptureShader::SetIntArray(const std::string& name, int* values, uint32_t count) {
+    RecordUniform(name, IntUniform, values, count);
+}
+
+void CaptureShader::SetFloat(const std::string& name, float value) {
+    RecordUniform(name, FloatUniform, &value, 1);
+}
+
+void CaptureShader::SetFloat3(const std::string& name, const glm::vec3& value) {
+    RecordUniform(name, FloatUniform, glm::value_ptr(value), 3);
+}
+
+void CaptureShader::SetFloat4(const std::string& name, const glm::vec4& value) {
+    RecordUniform(name, FloatUniform, glm::value_ptr(value), 4);
+}
+
+void CaptureShader::SetMat4(const std::string& name, const glm::mat4& value) {
+    RecordUniform(name, FloatUniform, glm::value_ptr(value), 16);
+}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Engine/Renderer/Shader.h"
+
+#include <vector>
+
+namespace Engine {
+
+// Sources are not read or compiled; binds and uniform values are recorded
+class CaptureShader : public Shader {
+public:
+    // SetUniform Args[0]
+    enum UniformType : uint32_t { IntUniform = 0, FloatUniform = 1 };
+
+    CaptureShader(const std::string& vertexPath, const std::string& fragmentPath);
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override {}
+
+    virtual void SetInt(const std::string& name, int value) override;
+    virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+    virtual void SetFloat(const std::string& name, float value) override;
+    virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
+    virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
+    virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
+
+private:
+    void RecordUniform(const std::string& name, UniformType type, const void* values, uint32_t count);
+
+    uint32_t m_ID;
+    std::vector<uint8_t> m_Scratch;
+};
+
+}
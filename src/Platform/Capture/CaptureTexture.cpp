@@ -0,0 +1,70 @@
+#include "Platform/Capture/CaptureTexture.h"
+#include "Platform/Capture/CaptureRecorder.h"
+#include "Engine/Core/Log.h"
+#include "stb_image.h"
+
+namespace Engine {
+
+// CreateTexture Args: width, height, layers, RenderTargetFormat (0 unless it is an attachment);
+// data: source path, if any
+// UploadTexture Args: x, y, width, height; layer uploads encode the layer in the high 16 bits of x
+// BindTexture Args: unit
+
+CaptureTexture2D::CaptureTexture2D(uint32_t width, uint32_t height)
+    : m_ID(CaptureRecorder::NewObject()), m_Width(width), m_Height(height) {
+    CaptureRecorder::Record(CaptureCommandType::CreateTexture, m_ID, {m_Width, m_Height, 1});
+}
+
+CaptureTexture2D::CaptureTexture2D(const std::string& path) : m_ID(CaptureRecorder::NewObject()) {
+    int width, height, channels;
+    if (stbi_info(path.c_str(), &width, &height, &channels)) {
+        m_Width = width;
+        m_Height = height;
+    } else {
+        ENG_CORE_WARN("Capture: could not read image {0}, using 1x1", path);
+    }
+    CaptureRecorder::Record(CaptureCommandType::CreateTexture, m_ID, {m_Width, m_Height, 1}, path.data(),
+                            static_cast<uint32_t>(path.size()));
+}
+
+CaptureTexture2D::CaptureTexture2D(uint32_t width, uint32_t height, RenderTargetFormat format)
+    : m_ID(CaptureRecorder::NewObject()), m_Width(width), m_Height(height) {
+    CaptureRecorder::Record(CaptureCommandType::CreateTexture, m_ID,
+                            {m_Width, m_Height, 1, static_cast<uint32_t>(format)});
+}
+
+void CaptureTexture2D::SetData(void* data, uint32_t size) {
+    CaptureRecorder::Record(CaptureCommandType::UploadTexture, m_ID, {0, 0, m_Width, m_Height});
+}
+
+void CaptureTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    CaptureRecorder::Record(CaptureCommandType::UploadTexture, m_ID, {x, y, width, height});
+}
+
+void CaptureTexture2D::Bind(uint32_t slot) const {
+    CaptureRecorder::Record(CaptureCommandType::BindTexture, m_ID, {slot});
+}
+
+CaptureTexture2DArray::CaptureTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+    : m_ID(CaptureRecorder::NewObject()), m_Width(width), m_Height(height), m_Layers(layers) {
+    CaptureRecorder::Record(CaptureCommandType::CreateTexture, m_ID, {m_Width, m_Height, m_Layers});
+}
+
+void CaptureTexture2DArray::SetData(void* data, uint32_t size) {
+    CaptureRecorder::Record(CaptureCommandType::UploadTexture, m_ID, {0, 0, m_Width, m_Height});
+}
+
+void CaptureTexture2DArray::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    SetLayerData(0, data, x, y, width, height);
+}
+
+void CaptureTexture2DArray::SetLayerData(uint32_t layer, const void* data, uint32_t x, uint32_t y, uint32_t width,
+                                         uint32_t height) {
+    CaptureRecorder::Record(CaptureCommandType::UploadTexture, m_ID, {(layer << 16) | x, y, width, height});
+}
+
+void CaptureTexture2DArray::Bind(uint32_t slot) const {
+    CaptureRecorder::Record(CaptureCommandType::BindTexture, m_ID, {slot});
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+#include "Engine/Renderer/Texture.h"
+
+namespace Engine {
+
+// Textures keep only their size; pixel uploads are recorded as regions without the pixels
+class CaptureTexture2D : public Texture2D {
+public:
+    CaptureTexture2D(uint32_t width, uint32_t height);
+    // Reads just the image header for the size; a missing file gives a 1x1 texture
+    CaptureTexture2D(const std::string& path);
+    // Framebuffer attachment
+    CaptureTexture2D(uint32_t width, uint32_t height, RenderTargetFormat format);
+
+    virtual uint32_t GetWidth() const override { return m_Width; }
+    virtual uint32_t GetHeight() const override { return m_Height; }
+    virtual uint32_t GetRendererID() const override { return m_ID; }
+
+    virtual void SetData(void* data, uint32_t size) override;
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+    virtual void Bind(uint32_t slot = 0) const override;
+
+    virtual bool operator==(const Texture& other) const override { return m_ID == other.GetRendererID(); }
+
+private:
+    uint32_t m_ID;
+    uint32_t m_Width = 1;
+    uint32_t m_Height = 1;
+};
+
+class CaptureTexture2DArray : public Texture2DArray {
+public:
+    CaptureTexture2DArray(uint32_t width, uint32_t height, uint32_t layers);
+
+    virtual uint32_t GetWidth() const override { return m_Width; }
+    virtual uint32_t GetHeight() const override { return m_Height; }
+    virtual uint32_t GetRendererID() const override { return m_ID; }
+    virtual uint32_t GetLayerCount() const override { return m_Layers; }
+
+    virtual void SetData(void* data, uint32_t size) override;
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    virtual void SetLayerData(uint32_t layer, const void* data, uint32_t x, uint32_t y, uint32_t width,
+                              uint32_t height) override;
+
+    virtual void Bind(uint32_t slot = 0) const override;
+
+    virtual bool operator==(const Texture& other) const override { return m_ID == other.GetRendererID(); }
+
+private:
+    uint32_t m_ID;
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_Layers;
+};
+
+}
@@ -0,0 +1,24 @@
+#include "Platform/Capture/CaptureVertexArray.h"
+#include "Platform/Capture/CaptureBuffer.h"
+#include "Platform/Capture/CaptureRecorder.h"
+
+namespace Engine {
+
+CaptureVertexArray::CaptureVertexArray() : m_ID(CaptureRecorder::NewObject()) {
+    CaptureRecorder::Record(CaptureCommandType::CreateVertexArray, m_ID);
+}
+
+void CaptureVertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) {
+    // The layout is read now, like glVertexAttribPointer would
+    auto* storage = dynamic_cast<const CaptureBufferStorage*>(vertexBuffer.get());
+    CaptureRecorder::RecordVertexBuffer(m_ID, storage ? storage->GetID() : 0, vertexBuffer->GetLayout());
+    m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void CaptureVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) {
+    auto* captured = dynamic_cast<const CaptureIndexBuffer*>(indexBuffer.get());
+    CaptureRecorder::Record(CaptureCommandType::SetIndexBuffer, m_ID, {captured ? captured->GetID() : 0});
+    m_IndexBuffer = indexBuffer;
+}
+
+}
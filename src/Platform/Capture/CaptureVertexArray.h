@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Engine/Renderer/VertexArray.h"
+
+namespace Engine {
+
+class CaptureVertexArray : public VertexArray {
+public:
+    CaptureVertexArray();
+
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+
+    virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override;
+    virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override;
+
+    virtual const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+    virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+    uint32_t GetID() const { return m_ID; }
+
+private:
+    uint32_t m_ID;
+    std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
+    std::shared_ptr<IndexBuffer> m_IndexBuffer;
+};
+
+}
@@ -1,6 +1,10 @@
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Engine/Core/Log.h"
 #include <glad/glad.h>
 
+#include <chrono>
+#include <cstring>
+
 namespace Engine {
 
 // --- VertexBuffer ---
@@ -29,9 +33,111 @@ void OpenGLVertexBuffer::Unbind() const {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
+void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+// --- StreamVertexBuffer ---
+
+OpenGLStreamVertexBuffer::OpenGLStreamVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+    : m_RegionSize(regionSize), m_RegionCount(regionCount), m_Fences(regionCount, nullptr) {
+    GLsizeiptr totalSize = static_cast<GLsizeiptr>(regionSize) * regionCount;
+    glGenBuffers(1, &m_RendererID);
     glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+
+    // glad only loads glBufferStorage for 4.4+ contexts, which is also where ARB_buffer_storage became core
+    m_Persistent = GLAD_GL_VERSION_4_4 && glBufferStorage;
+    if (m_Persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, totalSize, nullptr, flags);
+        m_PersistentPtr = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags));
+        m_Persistent = m_PersistentPtr != nullptr;
+    }
+    if (!m_Persistent) {
+        glBufferData(GL_ARRAY_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+    }
+    ENG_CORE_INFO("Stream vertex buffer: {0} x {1} bytes ({2})", regionCount, regionSize,
+                  m_Persistent ? "persistent mapping" : "orphaning fallback");
+}
+
+OpenGLStreamVertexBuffer::~OpenGLStreamVertexBuffer() {
+    for (void* fence : m_Fences) {
+        if (fence) glDeleteSync(static_cast<GLsync>(fence));
+    }
+    if (m_MappedPtr || m_PersistentPtr) {
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    glDeleteBuffers(1, &m_RendererID);
+}
+
+void OpenGLStreamVertexBuffer::Bind() const {
+    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+}
+
+void OpenGLStreamVertexBuffer::Unbind() const {
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void OpenGLStreamVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+    // Convenience path for callers that do not care about the region offset: lands at `offset`
+    // into the current region like the staging-copy upload it replaces
+    std::memcpy(static_cast<uint8_t*>(Map()) + offset, data, size);
+    Unmap(offset + size);
+    Fence();
+}
+
+void* OpenGLStreamVertexBuffer::Map() {
+    m_LastWaitTime = 0.0f;
+    if (m_MappedPtr) return m_MappedPtr;
+
+    GLintptr offset = static_cast<GLintptr>(m_Region) * m_RegionSize;
+
+    if (m_Persistent) {
+        GLsync fence = static_cast<GLsync>(m_Fences[m_Region]);
+        if (fence) {
+            // Only blocks when the GPU is a full ring behind
+            auto start = std::chrono::high_resolution_clock::now();
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            while (result == GL_TIMEOUT_EXPIRED) {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            m_LastWaitTime = std::chrono::duration<float, std::milli>(end - start).count();
+
+            glDeleteSync(fence);
+            m_Fences[m_Region] = nullptr;
+        }
+        m_MappedPtr = m_PersistentPtr + offset;
+        return m_MappedPtr;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    if (m_Region == 0) {
+        // Orphan on wrap: the driver hands us fresh storage while the GPU keeps reading the old one
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_RegionSize) * m_RegionCount, nullptr,
+                     GL_STREAM_DRAW);
+    }
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    m_MappedPtr = glMapBufferRange(GL_ARRAY_BUFFER, offset, m_RegionSize, flags);
+    return m_MappedPtr;
+}
+
+uint32_t OpenGLStreamVertexBuffer::Unmap(uint32_t usedSize) {
+    if (!m_Persistent && m_MappedPtr) {
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    m_MappedPtr = nullptr;
+    return m_Region * m_RegionSize;
+}
+
+void OpenGLStreamVertexBuffer::Fence() {
+    if (m_Persistent) {
+        m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    m_Region = (m_Region + 1) % m_RegionCount;
 }
 
 // --- IndexBuffer ---
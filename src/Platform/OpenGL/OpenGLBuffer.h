@@ -13,7 +13,7 @@ public:
     virtual void Bind() const override;
     virtual void Unbind() const override;
 
-    virtual void SetData(const void* data, uint32_t size) override;
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
 
     virtual const BufferLayout& GetLayout() const override { return m_Layout; }
     virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
@@ -23,6 +23,43 @@ private:
     BufferLayout m_Layout;
 };
 
+// Uses persistent, coherent mapping (glBufferStorage, GL 4.4) with one fence per region.
+// Without it, falls back to unsynchronized maps of successive regions and orphans the
+// whole buffer whenever the ring wraps.
+class OpenGLStreamVertexBuffer : public StreamVertexBuffer {
+public:
+    OpenGLStreamVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+    virtual ~OpenGLStreamVertexBuffer();
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+    virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+    virtual void* Map() override;
+    virtual uint32_t Unmap(uint32_t usedSize) override;
+    virtual void Fence() override;
+
+    virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+    virtual float GetLastWaitTime() const override { return m_LastWaitTime; }
+
+private:
+    uint32_t m_RendererID;
+    BufferLayout m_Layout;
+
+    uint32_t m_RegionSize;
+    uint32_t m_RegionCount;
+    uint32_t m_Region = 0;
+    bool m_Persistent = false;
+    uint8_t* m_PersistentPtr = nullptr;
+    void* m_MappedPtr = nullptr;
+    std::vector<void*> m_Fences; // GLsync per region
+    float m_LastWaitTime = 0.0f;
+};
+
 class OpenGLIndexBuffer : public IndexBuffer {
 public:
     OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
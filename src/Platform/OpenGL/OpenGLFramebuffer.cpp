@@ -0,0 +1,108 @@
+#include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Engine/Core/Log.h"
+
+namespace Engine {
+
+struct GLFormat {
+    GLenum Internal;
+    GLenum Data; // pixel layout and type for SetData
+    GLenum Type;
+};
+
+static GLFormat ToGLFormat(RenderTargetFormat format) {
+    switch (format) {
+        case RenderTargetFormat::None:            break;
+        case RenderTargetFormat::RGBA8:           return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE};
+        case RenderTargetFormat::RGBA16F:         return {GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT};
+        case RenderTargetFormat::R11G11B10F:      return {GL_R11F_G11F_B10F, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV};
+        case RenderTargetFormat::Depth24Stencil8: return {GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8};
+    }
+    return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE};
+}
+
+OpenGLRenderTexture::OpenGLRenderTexture(uint32_t width, uint32_t height, RenderTargetFormat format)
+    : m_Width(width), m_Height(height), m_Format(format) {
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+    glTextureStorage2D(m_RendererID, 1, ToGLFormat(format).Internal, m_Width, m_Height);
+    // Post passes sample across the whole target, and never past its edges
+    glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+OpenGLRenderTexture::~OpenGLRenderTexture() { glDeleteTextures(1, &m_RendererID); }
+
+void OpenGLRenderTexture::SetData(void* data, uint32_t size) {
+    if (size != m_Width * m_Height * GetRenderTargetFormatSize(m_Format)) {
+        ENG_CORE_ERROR("Data size does not match render texture size!");
+        return;
+    }
+    SetSubData(data, 0, 0, m_Width, m_Height);
+}
+
+void OpenGLRenderTexture::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    if (x + width > m_Width || y + height > m_Height) {
+        ENG_CORE_ERROR("Sub data region is outside the render texture!");
+        return;
+    }
+    const GLFormat format = ToGLFormat(m_Format);
+    glTextureSubImage2D(m_RendererID, 0, x, y, width, height, format.Data, format.Type, data);
+}
+
+void OpenGLRenderTexture::Bind(uint32_t slot) const { glBindTextureUnit(slot, m_RendererID); }
+
+OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpec& spec) : Framebuffer(spec) { Invalidate(); }
+
+OpenGLFramebuffer::~OpenGLFramebuffer() { glDeleteFramebuffers(1, &m_RendererID); }
+
+void OpenGLFramebuffer::Invalidate() {
+    if (m_RendererID) {
+        glDeleteFramebuffers(1, &m_RendererID);
+        for (auto& attachment : m_ColorAttachments) attachment.reset();
+        m_DepthAttachment.reset();
+    }
+    glCreateFramebuffers(1, &m_RendererID);
+
+    GLenum drawBuffers[MAX_COLOR_ATTACHMENTS];
+    const uint32_t colorCount = static_cast<uint32_t>(m_Spec.ColorAttachments.size());
+    for (uint32_t i = 0; i < colorCount; i++) {
+        m_ColorAttachments[i] = std::make_shared<OpenGLRenderTexture>(m_Spec.Width, m_Spec.Height,
+                                                                      m_Spec.ColorAttachments[i]);
+        glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0 + i, m_ColorAttachments[i]->GetRendererID(), 0);
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    if (colorCount > 0) {
+        glNamedFramebufferDrawBuffers(m_RendererID, colorCount, drawBuffers);
+    } else {
+        // Depth-only, e.g. a depth prepass
+        glNamedFramebufferDrawBuffer(m_RendererID, GL_NONE);
+    }
+
+    if (m_Spec.DepthAttachment != RenderTargetFormat::None) {
+        m_DepthAttachment = std::make_shared<OpenGLRenderTexture>(m_Spec.Width, m_Spec.Height, m_Spec.DepthAttachment);
+        glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment->GetRendererID(), 0);
+    }
+
+    GLenum status = glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        ENG_CORE_ERROR("Framebuffer: incomplete ({0:#x}) at {1}x{2}", status, m_Spec.Width, m_Spec.Height);
+    }
+}
+
+void OpenGLFramebuffer::Bind() {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+    glViewport(0, 0, m_Spec.Width, m_Spec.Height);
+}
+
+void OpenGLFramebuffer::Unbind() { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
+
+void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height) {
+    // A minimized window reports 0x0, keep the old attachments until it comes back
+    if (width == 0 || height == 0 || (width == m_Spec.Width && height == m_Spec.Height)) return;
+    m_Spec.Width = width;
+    m_Spec.Height = height;
+    Invalidate();
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+#include <glad/glad.h>
+
+#include <array>
+
+namespace Engine {
+
+// Framebuffer attachment, an immutable-storage texture in any RenderTargetFormat.
+// SetData expects pixels in the format's natural layout (half floats for RGBA16F, packed
+// 10F_11F_11F_REV for R11G11B10F, 24_8 for depth-stencil).
+class OpenGLRenderTexture : public Texture2D {
+public:
+    OpenGLRenderTexture(uint32_t width, uint32_t height, RenderTargetFormat format);
+    virtual ~OpenGLRenderTexture();
+
+    virtual uint32_t GetWidth() const override { return m_Width; }
+    virtual uint32_t GetHeight() const override { return m_Height; }
+    virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+    virtual void SetData(void* data, uint32_t size) override;
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+    virtual void Bind(uint32_t slot = 0) const override;
+
+    virtual bool operator==(const Texture& other) const override { return m_RendererID == other.GetRendererID(); }
+
+private:
+    uint32_t m_Width;
+    uint32_t m_Height;
+    RenderTargetFormat m_Format;
+    uint32_t m_RendererID = 0;
+};
+
+class OpenGLFramebuffer : public Framebuffer {
+public:
+    explicit OpenGLFramebuffer(const FramebufferSpec& spec);
+    virtual ~OpenGLFramebuffer();
+
+    virtual void Bind() override;
+    virtual void Unbind() override;
+    virtual void Resize(uint32_t width, uint32_t height) override;
+
+    virtual const std::shared_ptr<Texture2D>& GetColorAttachment(uint32_t index = 0) const override {
+        return m_ColorAttachments[index];
+    }
+    virtual const std::shared_ptr<Texture2D>& GetDepthAttachment() const override { return m_DepthAttachment; }
+
+private:
+    // (Re)creates the framebuffer object and its attachments from m_Spec
+    void Invalidate();
+
+    uint32_t m_RendererID = 0;
+    std::array<std::shared_ptr<Texture2D>, MAX_COLOR_ATTACHMENTS> m_ColorAttachments;
+    std::shared_ptr<Texture2D> m_DepthAttachment;
+};
+
+}
@@ -0,0 +1,107 @@
+#include "Platform/OpenGL/OpenGLGPUTimer.h"
+#include "Engine/Core/Profiler.h"
+
+#include <glad/glad.h>
+
+namespace Engine {
+
+static constexpr uint32_t CLOCK_SYNC_FRAMES = 120;
+
+bool OpenGLGPUTimer::IsSupported() {
+    return GLAD_GL_VERSION_3_3 && glQueryCounter && glGetQueryObjectui64v;
+}
+
+OpenGLGPUTimer::OpenGLGPUTimer(uint32_t framesInFlight) : m_Frames(framesInFlight < 2 ? 2 : framesInFlight) {
+    SyncClock();
+}
+
+OpenGLGPUTimer::~OpenGLGPUTimer() {
+    for (Frame& frame : m_Frames) {
+        if (!frame.Queries.empty()) glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+    }
+}
+
+void OpenGLGPUTimer::SyncClock() {
+    GLint64 gpuTime = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+    m_ClockOffset = static_cast<int64_t>(gpuTime) - static_cast<int64_t>(Profiler::ClockNow());
+    m_FramesSinceSync = 0;
+}
+
+bool OpenGLGPUTimer::BeginFrame() {
+    const uint32_t count = static_cast<uint32_t>(m_Frames.size());
+    if (++m_FramesSinceSync >= CLOCK_SYNC_FRAMES) SyncClock();
+
+    // Slots [m_Collected, m_Frame) wait for results. Oldest first; frames finish in order, so
+    // stop at the first one still in flight.
+    bool collected = false;
+    while (m_Collected != m_Frame) {
+        Frame& frame = m_Frames[m_Collected];
+        if (frame.Used > 0) {
+            if (!Collect(frame)) break;
+            collected = true;
+        }
+        m_Collected = (m_Collected + 1) % count;
+    }
+
+    m_Frame = (m_Frame + 1) % count;
+    if (m_Frame == m_Collected) {
+        // The GPU is a whole ring behind; waiting here is exactly the stall we avoid
+        if (m_Frames[m_Frame].Used > 0) m_DroppedFrames++;
+        m_Collected = (m_Collected + 1) % count;
+    }
+    Frame& frame = m_Frames[m_Frame];
+    frame.Used = 0;
+    frame.Ranges.clear();
+    m_Depth = 0;
+    return collected;
+}
+
+uint32_t OpenGLGPUTimer::NextQuery() {
+    Frame& frame = m_Frames[m_Frame];
+    if (frame.Used == frame.Queries.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.Queries.push_back(query);
+    }
+    return frame.Queries[frame.Used++];
+}
+
+uint32_t OpenGLGPUTimer::BeginRange(const char* name) {
+    Frame& frame = m_Frames[m_Frame];
+    uint32_t query = NextQuery();
+    glQueryCounter(query, GL_TIMESTAMP);
+    frame.Ranges.push_back({name, query, 0, m_Depth++});
+    return static_cast<uint32_t>(frame.Ranges.size() - 1);
+}
+
+void OpenGLGPUTimer::EndRange(uint32_t range) {
+    Frame& frame = m_Frames[m_Frame];
+    if (range >= frame.Ranges.size()) return;
+    uint32_t query = NextQuery();
+    glQueryCounter(query, GL_TIMESTAMP);
+    frame.Ranges[range].EndQuery = query;
+    if (m_Depth > 0) m_Depth--;
+}
+
+bool OpenGLGPUTimer::Collect(Frame& frame) {
+    // Queries complete in submission order, the last one stands for the frame
+    GLuint available = 0;
+    glGetQueryObjectuiv(frame.Queries[frame.Used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return false;
+
+    m_Results.clear();
+    for (const PendingRange& range : frame.Ranges) {
+        if (!range.EndQuery) continue; // never ended
+        GLuint64 start = 0, end = 0;
+        glGetQueryObjectui64v(range.BeginQuery, GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(range.EndQuery, GL_QUERY_RESULT, &end);
+        m_Results.push_back({range.Name, static_cast<uint64_t>(static_cast<int64_t>(start) - m_ClockOffset),
+                             static_cast<uint64_t>(static_cast<int64_t>(end) - m_ClockOffset), range.Depth});
+    }
+    frame.Used = 0;
+    frame.Ranges.clear();
+    return true;
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Engine/Renderer/GPUTimer.h"
+
+namespace Engine {
+
+// GL_TIMESTAMP queries (glQueryCounter) rather than GL_TIME_ELAPSED, which cannot nest.
+// Every frame slot owns a growing pool of query objects, reused once its results are read.
+class OpenGLGPUTimer : public GPUTimer {
+public:
+    explicit OpenGLGPUTimer(uint32_t framesInFlight);
+    virtual ~OpenGLGPUTimer();
+
+    virtual bool BeginFrame() override;
+    virtual uint32_t BeginRange(const char* name) override;
+    virtual void EndRange(uint32_t range) override;
+
+    virtual const std::vector<GPUTimerRange>& GetResults() const override { return m_Results; }
+    virtual uint32_t GetDroppedFrames() const override { return m_DroppedFrames; }
+
+    // ARB_timer_query, core since 3.3 and exposed by Mesa's software rasterizers
+    static bool IsSupported();
+
+private:
+    struct PendingRange {
+        const char* Name;
+        uint32_t BeginQuery;
+        uint32_t EndQuery;
+        uint32_t Depth;
+    };
+
+    struct Frame {
+        std::vector<uint32_t> Queries; // GL query objects, the first Used are in flight
+        uint32_t Used = 0;
+        std::vector<PendingRange> Ranges;
+    };
+
+    uint32_t NextQuery();
+    bool Collect(Frame& frame);
+    void SyncClock();
+
+    std::vector<Frame> m_Frames;
+    uint32_t m_Frame = 0;
+    uint32_t m_Collected = 0; // oldest frame slot that may still have pending queries
+    uint32_t m_Depth = 0;
+
+    std::vector<GPUTimerRange> m_Results;
+    uint32_t m_DroppedFrames = 0;
+
+    // GPU timestamp minus Profiler::ClockNow(), refreshed every CLOCK_SYNC_FRAMES against drift
+    int64_t m_ClockOffset = 0;
+    uint32_t m_FramesSinceSync = 0;
+};
+
+}
@@ -23,10 +23,66 @@ void OpenGLRendererAPI::Clear() {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
-void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount) {
+void OpenGLRendererAPI::SetDepthTest(bool enabled) {
+    if (enabled)
+        glEnable(GL_DEPTH_TEST);
+    else
+        glDisable(GL_DEPTH_TEST);
+}
+
+void OpenGLRendererAPI::SetBlendFunc(BlendFunc func) {
+    switch (func) {
+        case BlendFunc::None:
+            glDisable(GL_BLEND);
+            return;
+        case BlendFunc::Alpha:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            return;
+        case BlendFunc::Additive:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_ONE, GL_ONE);
+            return;
+    }
+}
+
+RendererCaps OpenGLRendererAPI::GetCaps() const {
+    GLint textureUnits = 0, textureSize = 0, arrayLayers = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &textureUnits);
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &textureSize);
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &arrayLayers);
+
+    RendererCaps caps;
+    caps.MaxTextureSlots = static_cast<uint32_t>(textureUnits);
+    caps.MaxTextureSize = static_cast<uint32_t>(textureSize);
+    caps.MaxArrayTextureLayers = static_cast<uint32_t>(arrayLayers);
+    return caps;
+}
+
+void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                    uint32_t baseVertex) {
     vertexArray->Bind();
     uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+    if (baseVertex)
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, baseVertex);
+    else
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+}
+
+void OpenGLRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                             uint32_t instanceCount) {
+    vertexArray->Bind();
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+}
+
+void OpenGLRendererAPI::DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                            uint32_t instanceCount, uint32_t baseInstance) {
+    vertexArray->Bind();
+    if (baseInstance)
+        glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, baseInstance);
+    else
+        glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, instanceCount);
 }
 
 }
\ No newline at end of file
@@ -11,8 +11,16 @@ public:
     virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
     virtual void SetClearColor(const glm::vec4& color) override;
     virtual void Clear() override;
+    virtual RendererCaps GetCaps() const override;
+    virtual void SetDepthTest(bool enabled) override;
+    virtual void SetBlendFunc(BlendFunc func) override;
 
-    virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+    virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0,
+                             uint32_t baseVertex = 0) override;
+    virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                      uint32_t instanceCount) override;
+    virtual void DrawArraysInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t vertexCount,
+                                     uint32_t instanceCount, uint32_t baseInstance = 0) override;
 };
 
 }
\ No newline at end of file
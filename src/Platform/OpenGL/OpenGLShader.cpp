@@ -1,4 +1,5 @@
 #include "OpenGLShader.h"
+#include "Engine/Core/Profiler.h"
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -9,6 +10,8 @@
 namespace Engine {
 
 OpenGLShader::OpenGLShader(const std::string& vertexPath, const std::string& fragmentPath) {
+    ENG_PROFILE_FUNCTION();
+
     std::string vertexSource = ReadFile(vertexPath);
     std::string fragmentSource = ReadFile(fragmentPath);
 
@@ -17,6 +20,7 @@ OpenGLShader::OpenGLShader(const std::string& vertexPath, const std::string& fra
     unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentSource);
 
     // link program
+    ENG_PROFILE_SCOPE("OpenGLShader::Link");
     m_RendererID = glCreateProgram();
     glAttachShader(m_RendererID, vs);
     glAttachShader(m_RendererID, fs);
@@ -55,6 +59,8 @@ std::string OpenGLShader::ReadFile(const std::string& filepath) {
 }
 
 unsigned int OpenGLShader::CompileShader(unsigned int type, const std::string& source) {
+    ENG_PROFILE_FUNCTION();
+
     unsigned int id = glCreateShader(type);
     const char* src = source.c_str();
     glShaderSource(id, 1, &src, nullptr);
@@ -1,4 +1,5 @@
 #include "OpenGLTexture.h"
+#include "Engine/Core/Profiler.h"
 #include <iostream>
 #include "stb_image.h"
 
@@ -30,9 +31,15 @@ OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height) : m_Width(widt
 }
 
 OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path) {
+    ENG_PROFILE_FUNCTION();
+
     int width, height, channels;
     stbi_set_flip_vertically_on_load(1); // OpenGL Left Bottom Origin
-    stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    stbi_uc* data;
+    {
+        ENG_PROFILE_SCOPE("stbi_load");
+        data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    }
 
     if (!data) {
         std::cerr << "[PLATFORM] Failed to load image: " << path << std::endl;
@@ -95,6 +102,20 @@ void OpenGLTexture2D::SetData(void* data, uint32_t size) {
 #endif
 }
 
+void OpenGLTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    if (x + width > m_Width || y + height > m_Height) {
+        std::cerr << "Sub data region is outside the texture!" << std::endl;
+        return;
+    }
+
+#if USE_OPENGL_45_DSA
+    glTextureSubImage2D(m_RendererID, 0, x, y, width, height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+#else
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+#endif
+}
+
 void OpenGLTexture2D::Bind(uint32_t slot) const {
 #if USE_OPENGL_45_DSA
     glBindTextureUnit(slot, m_RendererID);
@@ -104,4 +125,68 @@ void OpenGLTexture2D::Bind(uint32_t slot) const {
 #endif
 }
 
+OpenGLTexture2DArray::OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+    : m_Width(width), m_Height(height), m_Layers(layers) {
+#if USE_OPENGL_45_DSA
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
+    glTextureStorage3D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height, m_Layers);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+#else
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, m_Width, m_Height, m_Layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+#endif
+}
+
+OpenGLTexture2DArray::~OpenGLTexture2DArray() { glDeleteTextures(1, &m_RendererID); }
+
+void OpenGLTexture2DArray::SetData(void* data, uint32_t size) {
+    if (size != m_Width * m_Height * m_Layers * 4) {
+        std::cerr << "Data size does not match texture array size!" << std::endl;
+        return;
+    }
+
+#if USE_OPENGL_45_DSA
+    glTextureSubImage3D(m_RendererID, 0, 0, 0, 0, m_Width, m_Height, m_Layers, GL_RGBA, GL_UNSIGNED_BYTE, data);
+#else
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, m_Width, m_Height, m_Layers, GL_RGBA, GL_UNSIGNED_BYTE, data);
+#endif
+}
+
+void OpenGLTexture2DArray::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    SetLayerData(0, data, x, y, width, height);
+}
+
+void OpenGLTexture2DArray::SetLayerData(uint32_t layer, const void* data, uint32_t x, uint32_t y, uint32_t width,
+                                        uint32_t height) {
+    if (layer >= m_Layers || x + width > m_Width || y + height > m_Height) {
+        std::cerr << "Sub data region is outside the texture array!" << std::endl;
+        return;
+    }
+
+#if USE_OPENGL_45_DSA
+    glTextureSubImage3D(m_RendererID, 0, x, y, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+#else
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+#endif
+}
+
+void OpenGLTexture2DArray::Bind(uint32_t slot) const {
+#if USE_OPENGL_45_DSA
+    glBindTextureUnit(slot, m_RendererID);
+#else
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+#endif
+}
+
 }
\ No newline at end of file
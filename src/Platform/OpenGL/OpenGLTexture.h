@@ -16,6 +16,7 @@ public:
     virtual uint32_t GetRendererID() const override { return m_RendererID; }
     
     virtual void SetData(void* data, uint32_t size) override;
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
     virtual void Bind(uint32_t slot = 0) const override;
     
@@ -32,4 +33,32 @@ private:
     GLenum m_DataFormat = 0;
 };
 
+class OpenGLTexture2DArray : public Texture2DArray {
+public:
+    OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers);
+    virtual ~OpenGLTexture2DArray();
+
+    virtual uint32_t GetWidth() const override { return m_Width; }
+    virtual uint32_t GetHeight() const override { return m_Height; }
+    virtual uint32_t GetRendererID() const override { return m_RendererID; }
+    virtual uint32_t GetLayerCount() const override { return m_Layers; }
+
+    virtual void SetData(void* data, uint32_t size) override;
+    virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    virtual void SetLayerData(uint32_t layer, const void* data, uint32_t x, uint32_t y, uint32_t width,
+                              uint32_t height) override;
+
+    virtual void Bind(uint32_t slot = 0) const override;
+
+    virtual bool operator==(const Texture& other) const override {
+        return m_RendererID == other.GetRendererID();
+    }
+
+private:
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    uint32_t m_Layers = 0;
+    uint32_t m_RendererID = 0;
+};
+
 }
\ No newline at end of file
@@ -16,6 +16,12 @@ static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
         case ShaderDataType::Int3:     return GL_INT;
         case ShaderDataType::Int4:     return GL_INT;
         case ShaderDataType::Bool:     return GL_BOOL;
+        case ShaderDataType::UByte:    return GL_UNSIGNED_BYTE;
+        case ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
+        case ShaderDataType::UShort:   return GL_UNSIGNED_SHORT;
+        case ShaderDataType::UShort2:  return GL_UNSIGNED_SHORT;
+        case ShaderDataType::UShort4:  return GL_UNSIGNED_SHORT;
+        case ShaderDataType::Half:     return GL_HALF_FLOAT;
         case ShaderDataType::None:     break;
     }
     return 0;
@@ -41,19 +47,32 @@ void OpenGLVertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& ver
     glBindVertexArray(m_RendererID);
     vertexBuffer->Bind();
 
+    // Attribute locations continue across buffers so per-vertex and per-instance
+    // streams can share one vertex array
     const auto& layout = vertexBuffer->GetLayout();
-    uint32_t index = 0;
     for (const auto& element : layout) {
-        glEnableVertexAttribArray(index);
-        glVertexAttribPointer(
-            index,
-            element.GetComponentCount(),
-            ShaderDataTypeToOpenGLBaseType(element.Type),
-            element.Normalized ? GL_TRUE : GL_FALSE,
-            layout.GetStride(),
-            reinterpret_cast<const void*>(element.Offset)
-        );
-        index++;
+        glEnableVertexAttribArray(m_VertexBufferIndex);
+        if (ShaderDataTypeIsInteger(element.Type) && !element.Normalized) {
+            // Without the I variant the values would arrive converted to float
+            glVertexAttribIPointer(
+                m_VertexBufferIndex,
+                element.GetComponentCount(),
+                ShaderDataTypeToOpenGLBaseType(element.Type),
+                layout.GetStride(),
+                reinterpret_cast<const void*>(element.Offset)
+            );
+        } else {
+            glVertexAttribPointer(
+                m_VertexBufferIndex,
+                element.GetComponentCount(),
+                ShaderDataTypeToOpenGLBaseType(element.Type),
+                element.Normalized ? GL_TRUE : GL_FALSE,
+                layout.GetStride(),
+                reinterpret_cast<const void*>(element.Offset)
+            );
+        }
+        glVertexAttribDivisor(m_VertexBufferIndex, layout.GetInstanceDivisor());
+        m_VertexBufferIndex++;
     }
 
     m_VertexBuffers.push_back(vertexBuffer);
@@ -20,6 +20,7 @@ public:
 
 private:
     uint32_t m_RendererID;
+    uint32_t m_VertexBufferIndex = 0;
     std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
     std::shared_ptr<IndexBuffer> m_IndexBuffer;
 };